@@ -0,0 +1,517 @@
+#include "AssetLoader.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <unordered_map>
+
+using Clock = std::chrono::steady_clock;
+
+static double millisecondsSince(Clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// CREATE
+// ------
+AssetLoader::~AssetLoader()
+{
+	destroy();
+}
+bool AssetLoader::create(Context& mainContext, JobSystem& jobs)
+{
+	destroy();
+	if (!m_uploadContext.createShared(mainContext))
+	{
+		std::cout << "Failed to create the asset upload context" << std::endl;
+		return false;
+	}
+	m_pending = 0;
+	m_stats = AssetLoaderStats{};
+	m_running = true;
+	m_jobs = &jobs;
+	m_decodeOnUpload = jobs.threadCount() < 2;
+	m_uploadThread = std::thread{ &AssetLoader::uploadLoop, this };
+	return true;
+}
+void AssetLoader::destroy()
+{
+	if (!m_running)
+		return;
+	finishAll();
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		m_running = false;
+	}
+	m_uploadReady.notify_all();
+	m_uploadThread.join();
+	m_jobs = nullptr;
+	m_uploadContext.destroy();
+	m_assets.clear();
+}
+// REQUESTS
+// --------
+int AssetLoader::loadTexture(const std::string& path)
+{
+	return request(path, AssetType::Texture);
+}
+int AssetLoader::loadMesh(const std::string& path)
+{
+	return request(path, AssetType::Mesh);
+}
+int AssetLoader::request(const std::string& path, AssetType type)
+{
+	std::unique_ptr<Asset> asset{ std::make_unique<Asset>() };
+	asset->path = path;
+	asset->type = type;
+	Asset* queued{ asset.get() };
+	m_assets.push_back(std::move(asset));
+	++m_pending;
+	++m_stats.requested;
+	if (m_decodeOnUpload)
+		queueUpload(queued);
+	else
+	{
+		m_jobs->run(m_decodeJobs, [this, queued]
+		{
+			decode(*queued);
+			queueUpload(queued);
+		});
+	}
+	return (int)m_assets.size() - 1;
+}
+void AssetLoader::queueUpload(Asset* asset)
+{
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		m_uploadQueue.push_back(asset);
+	}
+	m_uploadReady.notify_one();
+}
+const Texture* AssetLoader::texture(int handle) const
+{
+	const Asset& asset{ *m_assets[handle] };
+	return asset.state == AssetState::Ready && asset.type == AssetType::Texture ? &asset.texture : nullptr;
+}
+const MeshAsset* AssetLoader::mesh(int handle) const
+{
+	const Asset& asset{ *m_assets[handle] };
+	return asset.state == AssetState::Ready && asset.type == AssetType::Mesh ? &asset.mesh : nullptr;
+}
+// DECODE JOBS
+// -----------
+void AssetLoader::decode(Asset& asset)
+{
+	PROFILE_SCOPE("Decode asset");
+	Clock::time_point start{ Clock::now() };
+	std::ifstream input{ asset.path, std::ios::binary };
+	if (!input)
+	{
+		std::cout << "Failed to open asset " << asset.path << std::endl;
+		asset.failed = true;
+		return;
+	}
+	std::vector<char> file{ std::istreambuf_iterator<char>{ input }, std::istreambuf_iterator<char>{} };
+	asset.readMilliseconds = millisecondsSince(start);
+
+	start = Clock::now();
+	bool decoded{ asset.type == AssetType::Texture ? decodeImage(file, asset.image) : decodeObj(file, asset.meshData) };
+	if (decoded && asset.type == AssetType::Mesh)
+		optimizeMesh(asset.meshData);
+	asset.decodeMilliseconds = millisecondsSince(start);
+	if (!decoded)
+	{
+		std::cout << "Failed to decode asset " << asset.path << std::endl;
+		asset.failed = true;
+	}
+}
+// UPLOAD THREAD
+// -------------
+void AssetLoader::uploadLoop()
+{
+	Profiler::setThreadName("Asset upload");
+	m_uploadContext.makeCurrent();
+	while (true)
+	{
+		Asset* asset{ nullptr };
+		{
+			std::unique_lock<std::mutex> lock{ m_mutex };
+			m_uploadReady.wait(lock, [this] { return !m_running || !m_uploadQueue.empty(); });
+			if (m_uploadQueue.empty())
+				break;
+			asset = m_uploadQueue.front();
+			m_uploadQueue.pop_front();
+		}
+		if (m_decodeOnUpload)
+			decode(*asset);
+		if (!asset->failed)
+			upload(*asset);
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			m_uploaded.push_back(asset);
+		}
+		m_fenced.notify_all();
+	}
+	m_uploadContext.releaseCurrent();
+}
+void AssetLoader::upload(Asset& asset)
+{
+	PROFILE_SCOPE("Upload asset");
+	Clock::time_point start{ Clock::now() };
+	if (asset.type == AssetType::Texture)
+	{
+		const DecodedImage& image{ asset.image };
+		int levels{ (int)image.levels.size() };
+		asset.texture.create2D(image.width, image.height, GL_RGBA8, levels);
+		int width{ image.width };
+		int height{ image.height };
+		for (int level{ 0 }; level < levels; ++level)
+		{
+			asset.texture.upload(level, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, image.levels[level].data());
+			asset.uploadedBytes += (long long)image.levels[level].size();
+			width = std::max(width / 2, 1);
+			height = std::max(height / 2, 1);
+		}
+		asset.texture.setFilter(levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR, GL_LINEAR);
+		asset.image = DecodedImage{};
+	}
+	else
+	{
+		const IndexedMesh& data{ asset.meshData };
+		GLsizeiptr vertexBytes{ (GLsizeiptr)(data.vertices.size() * sizeof(float)) };
+		GLsizeiptr indexBytes{ (GLsizeiptr)(data.indices.size() * sizeof(std::uint32_t)) };
+		if (!asset.mesh.vertexBuffer.create(vertexBytes, data.vertices.data()) || !asset.mesh.indexBuffer.create(indexBytes, data.indices.data()))
+			asset.failed = true;
+		asset.mesh.vertexCount = data.vertexCount();
+		asset.mesh.indexCount = (std::uint32_t)data.indices.size();
+		asset.uploadedBytes = vertexBytes + indexBytes;
+		asset.meshData = IndexedMesh{};
+	}
+	// The flush sends the fence (and the uploads before it) to the GPU, the
+	// main context only polls it
+	asset.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	glFlush();
+	asset.uploadMilliseconds = millisecondsSince(start);
+}
+// PUBLISHING
+// ----------
+void AssetLoader::poll()
+{
+	if (m_pending == 0)
+		return;
+	PROFILE_SCOPE("AssetLoader::poll");
+	Clock::time_point start{ Clock::now() };
+	std::vector<Asset*> uploaded{};
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		uploaded.swap(m_uploaded);
+	}
+	std::vector<Asset*> waiting{};
+	for (Asset* asset : uploaded)
+	{
+		if (asset->fence != nullptr)
+		{
+			GLint status{ GL_UNSIGNALED };
+			glGetSynciv(asset->fence, GL_SYNC_STATUS, 1, nullptr, &status);
+			if (status != GL_SIGNALED)
+			{
+				waiting.push_back(asset);
+				continue;
+			}
+			glDeleteSync(asset->fence);
+			asset->fence = nullptr;
+		}
+		publish(*asset);
+	}
+	if (!waiting.empty())
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		m_uploaded.insert(m_uploaded.end(), waiting.begin(), waiting.end());
+	}
+	m_stats.maxPollMilliseconds = std::max(m_stats.maxPollMilliseconds, millisecondsSince(start));
+}
+void AssetLoader::publish(Asset& asset)
+{
+	--m_pending;
+	m_stats.readMilliseconds += asset.readMilliseconds;
+	m_stats.decodeMilliseconds += asset.decodeMilliseconds;
+	m_stats.uploadMilliseconds += asset.uploadMilliseconds;
+	if (asset.failed)
+	{
+		asset.state = AssetState::Failed;
+		++m_stats.failed;
+		return;
+	}
+	if (asset.type == AssetType::Mesh)
+	{
+		MeshAsset& mesh{ asset.mesh };
+		GLsizei stride{ MESH_FLOATS_PER_VERTEX * sizeof(float) };
+		mesh.vertexArray.create();
+		mesh.vertexArray.setVertexBuffer(0, mesh.vertexBuffer, 0, stride);
+		mesh.vertexArray.setIndexBuffer(mesh.indexBuffer);
+		mesh.vertexArray.setAttribute(0, 0, 3, GL_FLOAT, false, 0);
+		mesh.vertexArray.setAttribute(1, 0, 3, GL_FLOAT, false, 3 * sizeof(float));
+		mesh.vertexArray.setAttribute(2, 0, 2, GL_FLOAT, false, 6 * sizeof(float));
+	}
+	asset.state = AssetState::Ready;
+	++m_stats.ready;
+	m_stats.uploadedBytes += asset.uploadedBytes;
+}
+void AssetLoader::finishAll()
+{
+	// Decode jobs still queued on this thread's deque only run once it waits
+	if (m_jobs != nullptr)
+		m_jobs->wait(m_decodeJobs);
+	while (m_pending > 0)
+	{
+		std::vector<GLsync> fences{};
+		{
+			std::unique_lock<std::mutex> lock{ m_mutex };
+			m_fenced.wait(lock, [this] { return !m_uploaded.empty(); });
+			for (Asset* asset : m_uploaded)
+				fences.push_back(asset->fence);
+		}
+		for (GLsync fence : fences)
+		{
+			if (fence != nullptr)
+				glClientWaitSync(fence, 0, 1000000000);
+		}
+		poll();
+	}
+}
+void AssetLoader::printStats() const
+{
+	std::cout << "Assets: " << m_stats.ready << " loaded, " << m_stats.failed << " failed, " << m_pending << " pending, "
+		<< m_stats.uploadedBytes / 1024 << " KiB uploaded (read " << m_stats.readMilliseconds << " ms, decode "
+		<< m_stats.decodeMilliseconds << " ms, upload " << m_stats.uploadMilliseconds << " ms off the main thread, longest poll "
+		<< m_stats.maxPollMilliseconds << " ms)" << std::endl;
+}
+// PPM/PGM DECODER
+// ---------------
+// Binary netpbm with at most 8 bits per channel, expanded to RGBA8, then
+// box filtered down to 1x1 so the upload needs no glGenerateMipmap.
+static bool readPnmNumber(const std::vector<char>& file, std::size_t& position, int& value)
+{
+	while (position < file.size())
+	{
+		if (file[position] == '#')
+		{
+			while (position < file.size() && file[position] != '\n')
+				++position;
+		}
+		else if (std::isspace((unsigned char)file[position]))
+			++position;
+		else
+			break;
+	}
+	if (position >= file.size() || !std::isdigit((unsigned char)file[position]))
+		return false;
+	value = 0;
+	while (position < file.size() && std::isdigit((unsigned char)file[position]) && value < 1000000)
+		value = value * 10 + (file[position++] - '0');
+	return true;
+}
+bool AssetLoader::decodeImage(const std::vector<char>& file, DecodedImage& image)
+{
+	if (file.size() < 2 || file[0] != 'P' || (file[1] != '5' && file[1] != '6'))
+		return false;
+	int channels{ file[1] == '6' ? 3 : 1 };
+	std::size_t position{ 2 };
+	int width{ 0 }, height{ 0 }, maximum{ 0 };
+	if (!readPnmNumber(file, position, width) || !readPnmNumber(file, position, height) || !readPnmNumber(file, position, maximum))
+		return false;
+	// A single whitespace character separates the header from the pixels
+	++position;
+	std::size_t pixels{ (std::size_t)width * height };
+	if (width <= 0 || height <= 0 || maximum <= 0 || maximum > 255 || position + pixels * channels > file.size())
+		return false;
+
+	image.width = width;
+	image.height = height;
+	image.levels.clear();
+	std::vector<unsigned char> level(pixels * 4);
+	const unsigned char* source{ (const unsigned char*)file.data() + position };
+	for (std::size_t i{ 0 }; i < pixels; ++i)
+	{
+		for (int c{ 0 }; c < 3; ++c)
+			level[i * 4 + c] = (unsigned char)(source[i * channels + (channels == 3 ? c : 0)] * 255 / maximum);
+		level[i * 4 + 3] = 255;
+	}
+	image.levels.push_back(std::move(level));
+
+	while (width > 1 || height > 1)
+	{
+		int nextWidth{ std::max(width / 2, 1) };
+		int nextHeight{ std::max(height / 2, 1) };
+		const std::vector<unsigned char>& previous{ image.levels.back() };
+		std::vector<unsigned char> next((std::size_t)nextWidth * nextHeight * 4);
+		for (int y{ 0 }; y < nextHeight; ++y)
+		{
+			int y0{ std::min(y * 2, height - 1) }, y1{ std::min(y * 2 + 1, height - 1) };
+			for (int x{ 0 }; x < nextWidth; ++x)
+			{
+				int x0{ std::min(x * 2, width - 1) }, x1{ std::min(x * 2 + 1, width - 1) };
+				for (int c{ 0 }; c < 4; ++c)
+				{
+					int sum{ previous[((std::size_t)y0 * width + x0) * 4 + c] + previous[((std::size_t)y0 * width + x1) * 4 + c]
+						+ previous[((std::size_t)y1 * width + x0) * 4 + c] + previous[((std::size_t)y1 * width + x1) * 4 + c] };
+					next[((std::size_t)y * nextWidth + x) * 4 + c] = (unsigned char)((sum + 2) / 4);
+				}
+			}
+		}
+		image.levels.push_back(std::move(next));
+		width = nextWidth;
+		height = nextHeight;
+	}
+	return true;
+}
+// OBJ DECODER
+// -----------
+// v, vt, vn and f records; everything else (materials, groups, smoothing) is
+// skipped. Each distinct position/UV/normal triple becomes one vertex. Files
+// without normals get area weighted smooth normals.
+// Missing UV and normal indices come back as 0
+static bool parseFaceVertex(const char*& cursor, int counts[3], int indices[3])
+{
+	indices[0] = indices[1] = indices[2] = 0;
+	for (int component{ 0 }; component < 3; ++component)
+	{
+		if (component > 0)
+		{
+			if (*cursor != '/')
+				return true;
+			++cursor;
+		}
+		if (*cursor == '/' || *cursor == ' ' || *cursor == '\t' || *cursor == '\0')
+			continue;
+		char* end{ nullptr };
+		long index{ std::strtol(cursor, &end, 10) };
+		if (end == cursor)
+			return false;
+		cursor = end;
+		// Negative indices count back from the latest element
+		if (index < 0)
+			index += counts[component] + 1;
+		if (index < 1 || index > counts[component])
+			return false;
+		indices[component] = (int)index;
+	}
+	return true;
+}
+bool AssetLoader::decodeObj(const std::vector<char>& file, IndexedMesh& mesh)
+{
+	std::vector<float> positions{}, texCoords{}, normals{};
+	std::unordered_map<std::uint64_t, std::uint32_t> vertexIndices{};
+	mesh = IndexedMesh{};
+	mesh.floatsPerVertex = MESH_FLOATS_PER_VERTEX;
+
+	std::string line{};
+	std::size_t position{ 0 };
+	while (position < file.size())
+	{
+		std::size_t end{ position };
+		while (end < file.size() && file[end] != '\n')
+			++end;
+		line.assign(file.data() + position, end - position);
+		position = end + 1;
+		const char* cursor{ line.c_str() };
+		while (*cursor == ' ' || *cursor == '\t')
+			++cursor;
+
+		if (cursor[0] == 'v' && (cursor[1] == ' ' || cursor[1] == 't' || cursor[1] == 'n'))
+		{
+			std::vector<float>& target{ cursor[1] == ' ' ? positions : cursor[1] == 't' ? texCoords : normals };
+			int components{ cursor[1] == 't' ? 2 : 3 };
+			cursor += cursor[1] == ' ' ? 1 : 2;
+			for (int c{ 0 }; c < components; ++c)
+			{
+				char* next{ nullptr };
+				float value{ std::strtof(cursor, &next) };
+				if (next == cursor)
+					return false;
+				target.push_back(value);
+				cursor = next;
+			}
+		}
+		else if (cursor[0] == 'f' && cursor[1] == ' ')
+		{
+			++cursor;
+			// Each index gets 21 bits of the vertex key
+			int counts[3]{ (int)positions.size() / 3, (int)texCoords.size() / 2, (int)normals.size() / 3 };
+			if (counts[0] >= (1 << 21) || counts[1] >= (1 << 21) || counts[2] >= (1 << 21))
+				return false;
+			std::vector<std::uint32_t> polygon{};
+			while (true)
+			{
+				while (*cursor == ' ' || *cursor == '\t' || *cursor == '\r')
+					++cursor;
+				if (*cursor == '\0')
+					break;
+				int indices[3]{};
+				if (!parseFaceVertex(cursor, counts, indices) || indices[0] == 0)
+					return false;
+				std::uint64_t key{ ((std::uint64_t)indices[0] << 42) | ((std::uint64_t)indices[1] << 21) | (std::uint64_t)indices[2] };
+				auto found{ vertexIndices.find(key) };
+				if (found == vertexIndices.end())
+				{
+					std::uint32_t index{ mesh.vertexCount() };
+					const float* p{ &positions[(indices[0] - 1) * 3] };
+					float vertex[MESH_FLOATS_PER_VERTEX]{ p[0], p[1], p[2], 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+					if (indices[2] != 0)
+						std::copy(&normals[(indices[2] - 1) * 3], &normals[(indices[2] - 1) * 3] + 3, vertex + 3);
+					if (indices[1] != 0)
+						std::copy(&texCoords[(indices[1] - 1) * 2], &texCoords[(indices[1] - 1) * 2] + 2, vertex + 6);
+					mesh.vertices.insert(mesh.vertices.end(), vertex, vertex + MESH_FLOATS_PER_VERTEX);
+					found = vertexIndices.emplace(key, index).first;
+				}
+				polygon.push_back(found->second);
+			}
+			if (polygon.size() < 3)
+				return false;
+			for (std::size_t i{ 1 }; i + 1 < polygon.size(); ++i)
+			{
+				mesh.indices.push_back(polygon[0]);
+				mesh.indices.push_back(polygon[i]);
+				mesh.indices.push_back(polygon[i + 1]);
+			}
+		}
+	}
+	if (mesh.indices.empty())
+		return false;
+
+	if (normals.empty())
+	{
+		for (std::size_t i{ 0 }; i < mesh.indices.size(); i += 3)
+		{
+			float* a{ &mesh.vertices[(std::size_t)mesh.indices[i] * MESH_FLOATS_PER_VERTEX] };
+			float* b{ &mesh.vertices[(std::size_t)mesh.indices[i + 1] * MESH_FLOATS_PER_VERTEX] };
+			float* c{ &mesh.vertices[(std::size_t)mesh.indices[i + 2] * MESH_FLOATS_PER_VERTEX] };
+			float edge1[3]{ b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+			float edge2[3]{ c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+			float normal[3]{ edge1[1] * edge2[2] - edge1[2] * edge2[1], edge1[2] * edge2[0] - edge1[0] * edge2[2], edge1[0] * edge2[1] - edge1[1] * edge2[0] };
+			for (float* vertex : { a, b, c })
+			{
+				for (int axis{ 0 }; axis < 3; ++axis)
+					vertex[3 + axis] += normal[axis];
+			}
+		}
+		for (std::uint32_t v{ 0 }; v < mesh.vertexCount(); ++v)
+		{
+			float* normal{ &mesh.vertices[(std::size_t)v * MESH_FLOATS_PER_VERTEX + 3] };
+			float length{ std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]) };
+			if (length > 0.0f)
+			{
+				for (int axis{ 0 }; axis < 3; ++axis)
+					normal[axis] /= length;
+			}
+		}
+	}
+	return true;
+}
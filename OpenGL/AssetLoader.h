@@ -0,0 +1,149 @@
+#pragma once
+#include "Context.h"
+#include "GLObjects.h"
+#include "JobSystem.h"
+#include "MeshOptimizer.h"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+enum class AssetType
+{
+	Texture, // binary PPM (P6) or PGM (P5), uploaded as RGBA8 with a full mip chain
+	Mesh     // Wavefront OBJ, polygons fanned into triangles
+};
+
+enum class AssetState
+{
+	Loading,
+	Ready,
+	Failed
+};
+
+// Mesh vertices are interleaved position, normal and UV floats at attribute
+// locations 0, 1 and 2
+constexpr int MESH_FLOATS_PER_VERTEX{ 8 };
+
+struct MeshAsset
+{
+	Buffer vertexBuffer{};
+	Buffer indexBuffer{};
+	VertexArray vertexArray{}; // vertex arrays are not shared, made on the main context when published
+	std::uint32_t vertexCount{ 0 };
+	std::uint32_t indexCount{ 0 };
+};
+
+struct AssetLoaderStats
+{
+	int requested{ 0 };
+	int ready{ 0 };
+	int failed{ 0 };
+	double readMilliseconds{ 0.0 };   // summed over assets, in the decode jobs
+	double decodeMilliseconds{ 0.0 };
+	double uploadMilliseconds{ 0.0 }; // on the upload thread
+	long long uploadedBytes{ 0 };
+	double maxPollMilliseconds{ 0.0 }; // longest poll() on the main thread
+};
+
+// ASSET LOADER
+// ------------
+// Loads without ever blocking the render loop. Files are read and decoded by
+// jobs on the JobSystem passed to create(); an upload thread with its own
+// context shared with the main one (Context::createShared) creates the
+// textures and buffers and puts a fence behind them. poll() on the main thread publishes assets whose fence has
+// signaled, without waiting, so an asset becomes visible at a frame boundary
+// only once the GPU copy is done. Handles work like ShaderManager's:
+//
+//   int rock{ loader.loadMesh("rock.obj") };
+//   ...
+//   loader.poll(); // once a frame
+//   if (const MeshAsset* mesh{ loader.mesh(rock) })
+//       draw(*mesh);
+//
+// Call everything except the worker internals from the thread that owns the
+// main context, which must also be the thread that created the JobSystem
+// (other threads would decode inline). When the JobSystem has no worker
+// threads the upload thread decodes too, so the render thread never does.
+// The upload thread stays a thread of its own: its context is current on it
+// for the loader's lifetime, which no job may assume of the worker it runs on.
+class AssetLoader
+{
+public:
+	AssetLoader() = default;
+	~AssetLoader();
+	AssetLoader(const AssetLoader&) = delete;
+	AssetLoader& operator=(const AssetLoader&) = delete;
+
+	bool create(Context& mainContext, JobSystem& jobs);
+	void destroy(); // finishes the work in flight first
+
+	int loadTexture(const std::string& path);
+	int loadMesh(const std::string& path);
+
+	void poll();
+	void finishAll(); // blocks until every requested asset is published or failed
+
+	AssetState state(int handle) const { return m_assets[handle]->state; }
+	const Texture* texture(int handle) const;  // nullptr until published
+	const MeshAsset* mesh(int handle) const;   // nullptr until published
+	int pending() const { return m_pending; }
+	const AssetLoaderStats& stats() const { return m_stats; }
+	void printStats() const;
+
+	// The decoders the jobs run, no GL involved. Both return false on malformed
+	// input, OBJ faces included that index past the elements defined before them.
+	struct DecodedImage
+	{
+		int width{ 0 };
+		int height{ 0 };
+		std::vector<std::vector<unsigned char>> levels{}; // RGBA8, largest first
+	};
+	static bool decodeImage(const std::vector<char>& file, DecodedImage& image);
+	static bool decodeObj(const std::vector<char>& file, IndexedMesh& mesh);
+
+private:
+	struct Asset
+	{
+		std::string path;
+		AssetType type;
+		AssetState state{ AssetState::Loading }; // main thread only
+		// Written by the workers, read by the main thread after publication
+		bool failed{ false };
+		DecodedImage image{};
+		IndexedMesh meshData{};
+		Texture texture{};
+		MeshAsset mesh{};
+		GLsync fence{ nullptr };
+		double readMilliseconds{ 0.0 };
+		double decodeMilliseconds{ 0.0 };
+		double uploadMilliseconds{ 0.0 };
+		long long uploadedBytes{ 0 };
+	};
+
+	int request(const std::string& path, AssetType type);
+	void queueUpload(Asset* asset);
+	void uploadLoop();
+	void decode(Asset& asset);
+	void upload(Asset& asset);
+	void publish(Asset& asset);
+
+	Context m_uploadContext{};
+	std::vector<std::unique_ptr<Asset>> m_assets{}; // main thread only, workers hold Asset pointers
+	JobSystem* m_jobs{ nullptr };
+	JobCounter m_decodeJobs{};
+	bool m_decodeOnUpload{ false }; // no worker threads to decode on
+	std::thread m_uploadThread{};
+	std::mutex m_mutex{};
+	std::condition_variable m_uploadReady{};
+	std::condition_variable m_fenced{};
+	std::deque<Asset*> m_uploadQueue{}; // decoded, or still to decode with m_decodeOnUpload
+	std::vector<Asset*> m_uploaded{}; // fenced, waiting for poll()
+	bool m_running{ false };
+	int m_pending{ 0 };
+	AssetLoaderStats m_stats{};
+};
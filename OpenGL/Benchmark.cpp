@@ -0,0 +1,1543 @@
+#include "AssetLoader.h"
+#include "BufferHeap.h"
+#include "CommandList.h"
+#include "Context.h"
+#include "DrawCommandBuffer.h"
+#include "FramePipeline.h"
+#include "GLObjects.h"
+#include "InstanceBuffer.h"
+#include "JobSystem.h"
+#include "MeshOptimizer.h"
+#include "Profiler.h"
+#include "ProgramCache.h"
+#include "RenderQueue.h"
+#include "RenderState.h"
+#include "RingBuffer.h"
+#include "ShaderManager.h"
+#include "VertexFormat.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// BENCHMARK HARNESS
+// -----------------
+// Every benchmark runs against a headless context so the numbers are
+// comparable between developer machines and display-less build hosts.
+// Run "Benchmark" for all of them or "Benchmark <name>..." for a subset.
+struct BenchmarkOptions
+{
+	int frames{ DEFAULT_HEADLESS_FRAMES };
+	int width{ 800 };
+	int height{ 800 };
+	int threads{ 4 };
+};
+
+struct Benchmark
+{
+	const char* name;
+	const char* description;
+	bool (*run)(const BenchmarkOptions& options);
+};
+
+using Clock = std::chrono::steady_clock;
+
+static double millisecondsSince(Clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static bool createHeadlessContext(Context& context, const BenchmarkOptions& options)
+{
+	ContextOptions contextOptions{};
+	contextOptions.backend = ContextBackend::Headless;
+	contextOptions.width = options.width;
+	contextOptions.height = options.height;
+	contextOptions.frameLimit = options.frames;
+	return context.create(contextOptions);
+}
+
+static unsigned int compileProgram(const char* vertexSource, const char* fragmentSource)
+{
+	unsigned int vertexShader{ compileShader(GL_VERTEX_SHADER, vertexSource) };
+	unsigned int fragmentShader{ compileShader(GL_FRAGMENT_SHADER, fragmentSource) };
+	unsigned int program{ vertexShader != 0 && fragmentShader != 0 ? linkProgram(vertexShader, fragmentShader, false) : 0 };
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+	return program;
+}
+
+// TRIANGLE SCENE
+// --------------
+// The demo's scene: one program and the single triangle VAO.
+struct TriangleScene
+{
+	unsigned int program{ 0 };
+	unsigned int VBO{ 0 };
+	unsigned int VAO{ 0 };
+
+	bool create()
+	{
+		program = compileProgram(
+			"#version 330 core\n"
+			"layout(location = 0) in vec3 aPos;\n"
+			"void main() { gl_Position = vec4(aPos, 1.0); }\n",
+			"#version 330 core\n"
+			"out vec4 FragColor;\n"
+			"void main() { FragColor = vec4(1.0, 0.0, 1.0, 1.0); }\n");
+		if (program == 0)
+			return false;
+		GLfloat vertices[]
+		{
+		-0.5f,0.0f,0.0f,
+		0.0f,0.5f,0.0f,
+		0.5f,0.0f,0.0f,
+		};
+		glGenVertexArrays(1, &VAO);
+		glGenBuffers(1, &VBO);
+		glBindVertexArray(VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, VBO);
+		glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GL_FLOAT), (void*)0);
+		glEnableVertexAttribArray(0);
+		return true;
+	}
+	void draw() const
+	{
+		glClearColor(0.0f, 0.0f, 0.1f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+		glUseProgram(program);
+		glBindVertexArray(VAO);
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+	}
+	void destroy()
+	{
+		glDeleteVertexArrays(1, &VAO);
+		glDeleteBuffers(1, &VBO);
+		glDeleteProgram(program);
+		program = VBO = VAO = 0;
+	}
+};
+
+// FRAME BENCHMARK
+// ---------------
+// The demo's render loop: clear, draw one triangle, present.
+static bool benchmarkFrame(const BenchmarkOptions& options)
+{
+	Context context{};
+	TriangleScene scene{};
+	if (!createHeadlessContext(context, options) || !scene.create())
+		return false;
+
+	Clock::time_point start{ Clock::now() };
+	while (!context.shouldClose())
+	{
+		scene.draw();
+		context.swapBuffers();
+	}
+	glFinish();
+	double elapsed{ millisecondsSince(start) };
+	std::cout << "  " << context.frameCount() << " frames, " << elapsed / context.frameCount() << " ms/frame, "
+		<< context.frameCount() * 1000.0 / elapsed << " fps" << std::endl;
+	scene.destroy();
+	return true;
+}
+
+// LOADER BENCHMARK
+// ----------------
+// Startup cost of a short-lived render job: load the GL function pointers
+// eagerly (every 4.6 entry point) or lazily (trampolines resolved on first
+// call), then set up and render the demo's single frame.
+static double timeLoadAndFrame(GLADloadproc loader, bool lazy, double& loadMilliseconds)
+{
+	Clock::time_point start{ Clock::now() };
+	if (!(lazy ? gladLoadGLLoaderLazy(loader) : gladLoadGLLoader(loader)))
+		return -1.0;
+	loadMilliseconds = millisecondsSince(start);
+
+	TriangleScene scene{};
+	if (!scene.create())
+		return -1.0;
+	scene.draw();
+	glFinish();
+	scene.destroy();
+	return millisecondsSince(start);
+}
+
+static bool benchmarkLoader(const BenchmarkOptions& options)
+{
+	Context context{};
+	if (!createHeadlessContext(context, options))
+		return false;
+	const int iterations{ 50 };
+	double eagerLoad{ 0.0 }, eagerTotal{ 0.0 }, lazyLoad{ 0.0 }, lazyTotal{ 0.0 };
+	for (int i{ 0 }; i < iterations; ++i)
+	{
+		// Alternate so driver-side caching favours neither mode
+		double load{ 0.0 };
+		double total{ timeLoadAndFrame(context.loader(), false, load) };
+		if (total < 0.0)
+			return false;
+		eagerLoad += load;
+		eagerTotal += total;
+		total = timeLoadAndFrame(context.loader(), true, load);
+		if (total < 0.0)
+			return false;
+		lazyLoad += load;
+		lazyTotal += total;
+	}
+	std::cout << "  eager: load " << eagerLoad * 1000.0 / iterations << " us, load + first frame "
+		<< eagerTotal / iterations << " ms" << std::endl;
+	std::cout << "  lazy:  load " << lazyLoad * 1000.0 / iterations << " us, load + first frame "
+		<< lazyTotal / iterations << " ms" << std::endl;
+	std::cout << "  saving per job: " << (eagerTotal - lazyTotal) * 1000.0 / iterations << " us" << std::endl;
+	return true;
+}
+
+// CONTEXTS BENCHMARK
+// ------------------
+// Render farm mode: one headless context per thread, each with its own
+// dispatch table, all rendering the demo scene at the same time.
+static bool benchmarkContexts(const BenchmarkOptions& options)
+{
+	std::vector<std::thread> workers{};
+	std::vector<long long> frames(options.threads, 0);
+	std::atomic<int> failures{ 0 };
+	Clock::time_point start{ Clock::now() };
+	for (int i{ 0 }; i < options.threads; ++i)
+	{
+		workers.emplace_back([&options, &frames, &failures, i]()
+			{
+				Context context{};
+				ContextOptions contextOptions{};
+				contextOptions.backend = ContextBackend::Headless;
+				contextOptions.width = options.width;
+				contextOptions.height = options.height;
+				contextOptions.frameLimit = options.frames;
+				contextOptions.contextDispatch = true;
+				TriangleScene scene{};
+				if (!context.create(contextOptions) || !scene.create())
+				{
+					++failures;
+					return;
+				}
+				while (!context.shouldClose())
+				{
+					scene.draw();
+					context.swapBuffers();
+				}
+				glFinish();
+				frames[i] = context.frameCount();
+				scene.destroy();
+			});
+	}
+	for (std::thread& worker : workers)
+		worker.join();
+	double elapsed{ millisecondsSince(start) };
+	long long total{ 0 };
+	for (long long count : frames)
+		total += count;
+	std::cout << "  " << options.threads << " contexts, " << total << " frames in " << elapsed << " ms, "
+		<< total * 1000.0 / elapsed << " fps aggregate" << std::endl;
+	return failures == 0;
+}
+
+// SHADERS BENCHMARK
+// -----------------
+// Startup shader builds: compile and check each program in turn (what main()
+// used to do) against submitting them all through the ShaderManager and only
+// collecting them afterwards.
+static std::string shaderVariant(const char* body, int variant)
+{
+	return std::string{ "#version 330 core\n#define VARIANT " } + std::to_string(variant) + "\n" + body;
+}
+
+static bool benchmarkShaders(const BenchmarkOptions& options)
+{
+	Context context{};
+	if (!createHeadlessContext(context, options))
+		return false;
+	const int programs{ 64 };
+	const char* vertexBody{
+		"layout(location = 0) in vec3 aPos;\n"
+		"out vec3 color;\n"
+		"void main() { color = vec3(float(VARIANT) / 64.0, sin(aPos.x * float(VARIANT)), 0.5); gl_Position = vec4(aPos, 1.0); }\n" };
+	const char* fragmentBody{
+		"in vec3 color;\n"
+		"out vec4 FragColor;\n"
+		"void main() { vec3 c = color; for (int i = 0; i < VARIANT % 8; ++i) c = fract(c * 1.7 + 0.1); FragColor = vec4(c, 1.0); }\n" };
+	// Different variant numbers per pass so the driver's own shader cache cannot help the second one
+	std::vector<std::string> sources{};
+	for (int i{ 0 }; i < 2 * programs; ++i)
+	{
+		sources.push_back(shaderVariant(vertexBody, i));
+		sources.push_back(shaderVariant(fragmentBody, i));
+	}
+
+	Clock::time_point start{ Clock::now() };
+	for (int i{ 0 }; i < programs; ++i)
+	{
+		unsigned int vertexShader{ compileShader(GL_VERTEX_SHADER, sources[i * 2].c_str()) };
+		unsigned int fragmentShader{ compileShader(GL_FRAGMENT_SHADER, sources[i * 2 + 1].c_str()) };
+		unsigned int program{ linkProgram(vertexShader, fragmentShader, false) };
+		glDeleteShader(vertexShader);
+		glDeleteShader(fragmentShader);
+		glDeleteProgram(program);
+	}
+	double serial{ millisecondsSince(start) };
+
+	start = Clock::now();
+	int failed{ 0 };
+	{
+		ShaderManager shaders{ context.loader() };
+		std::vector<int> handles{};
+		for (int i{ programs }; i < 2 * programs; ++i)
+			handles.push_back(shaders.add("variant", sources[i * 2].c_str(), sources[i * 2 + 1].c_str()));
+		double submitted{ millisecondsSince(start) };
+		for (int handle : handles)
+			failed += shaders.program(handle) == 0;
+		std::cout << "  " << programs << " programs, serial " << serial << " ms, async " << millisecondsSince(start)
+			<< " ms (" << submitted << " ms to submit)" << std::endl;
+		std::cout << "  ";
+		shaders.printStats();
+	}
+	return failed == 0;
+}
+
+// QUEUE BENCHMARK
+// ---------------
+// A frame of small draws spread over several programs and vertex arrays,
+// submitted in gameplay order: straight through the state cache against
+// collected in a RenderQueue and sorted by key first.
+static bool benchmarkQueue(const BenchmarkOptions& options)
+{
+	Context context{};
+	if (!createHeadlessContext(context, options))
+		return false;
+	const int programCount{ 8 };
+	const int vertexArrayCount{ 16 };
+	const int items{ 4096 };
+	TriangleScene scenes[vertexArrayCount]{};
+	for (TriangleScene& scene : scenes)
+	{
+		if (!scene.create())
+			return false;
+	}
+	unsigned int programs[programCount]{};
+	for (int i{ 0 }; i < programCount; ++i)
+		programs[i] = scenes[i].program;
+
+	std::vector<DrawItem> frame(items);
+	std::mt19937 random{ 1234 };
+	std::uniform_real_distribution<float> depth{ 0.0f, 1.0f };
+	for (DrawItem& item : frame)
+	{
+		item.program = programs[random() % programCount];
+		item.vertexArray = scenes[random() % vertexArrayCount].VAO;
+		item.count = 3;
+		item.key = makeSortKey(0, item.program, 0, item.vertexArray, depth(random));
+	}
+
+	const int frames{ options.frames < 60 ? options.frames : 60 };
+	RenderStateCache state{};
+	Clock::time_point start{ Clock::now() };
+	for (int f{ 0 }; f < frames; ++f)
+	{
+		state.beginFrame();
+		for (const DrawItem& item : frame)
+		{
+			state.useProgram(item.program);
+			state.bindVertexArray(item.vertexArray);
+			glDrawArrays(item.mode, item.first, item.count);
+		}
+		glFinish();
+	}
+	double unsorted{ millisecondsSince(start) / frames };
+	long long unsortedIssued{ state.frame().issued };
+
+	RenderQueue queue{};
+	double sortMilliseconds{ 0.0 };
+	start = Clock::now();
+	for (int f{ 0 }; f < frames; ++f)
+	{
+		state.beginFrame();
+		for (const DrawItem& item : frame)
+			queue.submit(item);
+		Clock::time_point sortStart{ Clock::now() };
+		queue.sort();
+		sortMilliseconds += millisecondsSince(sortStart);
+		queue.flush(state);
+		glFinish();
+	}
+	double sorted{ millisecondsSince(start) / frames };
+	std::cout << "  " << items << " draws, unsorted " << unsorted << " ms/frame (" << unsortedIssued
+		<< " state calls), sorted " << sorted << " ms/frame (" << state.frame().issued << " state calls, "
+		<< sortMilliseconds / frames << " ms sorting)" << std::endl;
+	for (TriangleScene& scene : scenes)
+		scene.destroy();
+	return true;
+}
+
+// INSTANCED SHADERS
+// -----------------
+// Place a mesh vertex with an InstanceData transform; the instanced variant
+// reads the transform and color from InstanceBuffer attributes 1 and 2.
+static const char* PLACE_FUNCTION{
+	"vec2 place(vec3 p, vec4 t) { float c = cos(t.w), s = sin(t.w); return t.xy + t.z * vec2(c * p.x - s * p.y, s * p.x + c * p.y); }\n" };
+static const char* COLOR_FRAGMENT{
+	"#version 330 core\n"
+	"in vec4 color;\n"
+	"out vec4 FragColor;\n"
+	"void main() { FragColor = color; }\n" };
+
+static unsigned int compileInstancedProgram()
+{
+	std::string vertex{ std::string{ "#version 330 core\n"
+		"layout(location = 0) in vec3 aPos;\n"
+		"layout(location = 1) in vec4 aTransform;\n"
+		"layout(location = 2) in vec4 aColor;\n"
+		"out vec4 color;\n" } + PLACE_FUNCTION
+		+ "void main() { color = aColor; gl_Position = vec4(place(aPos, aTransform), 0.0, 1.0); }\n" };
+	return compileProgram(vertex.c_str(), COLOR_FRAGMENT);
+}
+
+static std::vector<InstanceData> randomInstances(int count, float scale)
+{
+	std::vector<InstanceData> instances(count);
+	std::mt19937 random{ 1234 };
+	std::uniform_real_distribution<float> unit{ 0.0f, 1.0f };
+	for (InstanceData& instance : instances)
+	{
+		instance.offset[0] = unit(random) * 2.0f - 1.0f;
+		instance.offset[1] = unit(random) * 2.0f - 1.0f;
+		instance.scale = scale * (1.0f + unit(random) * 1.5f);
+		instance.rotation = unit(random) * 6.2831853f;
+		instance.color[0] = unit(random);
+		instance.color[1] = unit(random);
+		instance.color[2] = unit(random);
+	}
+	return instances;
+}
+
+// INSTANCING BENCHMARK
+// --------------------
+// Many copies of the demo triangle, each with its own offset, scale, rotation
+// and color: one uniform update and draw call per object against a single
+// instanced draw fed from an InstanceBuffer.
+static bool benchmarkInstancing(const BenchmarkOptions& options)
+{
+	Context context{};
+	TriangleScene scene{};
+	if (!createHeadlessContext(context, options) || !scene.create())
+		return false;
+	std::string perObjectVertex{ std::string{ "#version 330 core\n"
+		"layout(location = 0) in vec3 aPos;\n"
+		"uniform vec4 transform;\n"
+		"uniform vec4 tint;\n"
+		"out vec4 color;\n" } + PLACE_FUNCTION
+		+ "void main() { color = tint; gl_Position = vec4(place(aPos, transform), 0.0, 1.0); }\n" };
+	unsigned int perObjectProgram{ compileProgram(perObjectVertex.c_str(), COLOR_FRAGMENT) };
+	unsigned int instancedProgram{ compileInstancedProgram() };
+	if (perObjectProgram == 0 || instancedProgram == 0)
+		return false;
+	int transformLocation{ glGetUniformLocation(perObjectProgram, "transform") };
+	int tintLocation{ glGetUniformLocation(perObjectProgram, "tint") };
+
+	const int objects{ 10000 };
+	std::vector<InstanceData> instances{ randomInstances(objects, 0.02f) };
+	const int frames{ options.frames < 20 ? options.frames : 20 };
+
+	glUseProgram(perObjectProgram);
+	glBindVertexArray(scene.VAO);
+	Clock::time_point start{ Clock::now() };
+	for (int f{ 0 }; f < frames; ++f)
+	{
+		glClear(GL_COLOR_BUFFER_BIT);
+		for (const InstanceData& instance : instances)
+		{
+			glUniform4fv(transformLocation, 1, instance.offset);
+			glUniform4fv(tintLocation, 1, instance.color);
+			glDrawArrays(GL_TRIANGLES, 0, 3);
+		}
+		glFinish();
+	}
+	double perObject{ millisecondsSince(start) / frames };
+
+	InstanceBuffer instanceBuffer{};
+	RenderStateCache state{};
+	if (!instanceBuffer.create(objects))
+		return false;
+	instanceBuffer.attach(state, scene.VAO, 1);
+	state.useProgram(instancedProgram);
+	start = Clock::now();
+	for (int f{ 0 }; f < frames; ++f)
+	{
+		glClear(GL_COLOR_BUFFER_BIT);
+		instanceBuffer.clear();
+		for (const InstanceData& instance : instances)
+			instanceBuffer.push(instance);
+		instanceBuffer.upload(state);
+		instanceBuffer.drawArrays(GL_TRIANGLES, 0, 3);
+		glFinish();
+	}
+	double instanced{ millisecondsSince(start) / frames };
+	std::cout << "  " << objects << " objects, per-object draws " << perObject << " ms/frame, instanced "
+		<< instanced << " ms/frame (" << perObject / instanced << "x)" << std::endl;
+
+	instanceBuffer.destroy();
+	glDeleteProgram(perObjectProgram);
+	glDeleteProgram(instancedProgram);
+	scene.destroy();
+	return true;
+}
+
+// INDIRECT BENCHMARK
+// ------------------
+// A large scene of small quads sharing one vertex array, each object picking
+// its transform through baseInstance: a glDrawElements call per object against
+// one glMultiDrawElementsIndirect over a DrawCommandBuffer. Submission time is
+// the CPU time until the draws are issued, frame time includes glFinish. Note
+// that llvmpipe runs vertex processing on the submitting thread, so there the
+// submission time also contains the GPU's vertex work.
+static bool benchmarkIndirect(const BenchmarkOptions& options)
+{
+	Context context{};
+	if (!createHeadlessContext(context, options))
+		return false;
+	unsigned int program{ compileInstancedProgram() };
+	if (program == 0)
+		return false;
+	GLfloat vertices[]
+	{
+	-0.5f,-0.5f,0.0f,
+	0.5f,-0.5f,0.0f,
+	0.5f,0.5f,0.0f,
+	-0.5f,0.5f,0.0f,
+	};
+	GLushort indices[]{ 0, 1, 2, 2, 3, 0 };
+	unsigned int VAO, VBO, EBO;
+	glGenVertexArrays(1, &VAO);
+	glGenBuffers(1, &VBO);
+	glGenBuffers(1, &EBO);
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GL_FLOAT), (void*)0);
+	glEnableVertexAttribArray(0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+	const int objects{ 100000 };
+	InstanceBuffer instanceBuffer{};
+	DrawCommandBuffer commands{};
+	RenderStateCache state{};
+	if (!instanceBuffer.create(objects) || !commands.create(state, objects, context.loader()))
+		return false;
+	instanceBuffer.attach(state, VAO, 1);
+	for (const InstanceData& instance : randomInstances(objects, 0.002f))
+		instanceBuffer.push(instance);
+	instanceBuffer.upload(state);
+
+	state.useProgram(program);
+	state.bindVertexArray(VAO);
+	const int frames{ options.frames < 10 ? options.frames : 10 };
+	double submitMilliseconds{ 0.0 };
+	Clock::time_point start{ Clock::now() };
+	for (int f{ 0 }; f < frames; ++f)
+	{
+		Clock::time_point submitStart{ Clock::now() };
+		glClear(GL_COLOR_BUFFER_BIT);
+		for (int i{ 0 }; i < objects; ++i)
+			glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, (void*)0, 1, 0, i);
+		submitMilliseconds += millisecondsSince(submitStart);
+		glFinish();
+	}
+	double perObject{ millisecondsSince(start) / frames };
+	double perObjectSubmit{ submitMilliseconds / frames };
+
+	submitMilliseconds = 0.0;
+	double buildMilliseconds{ 0.0 };
+	start = Clock::now();
+	for (int f{ 0 }; f < frames; ++f)
+	{
+		Clock::time_point submitStart{ Clock::now() };
+		glClear(GL_COLOR_BUFFER_BIT);
+		commands.clear();
+		for (int i{ 0 }; i < objects; ++i)
+			commands.add(6, 0, 0, i);
+		commands.upload(state);
+		buildMilliseconds += millisecondsSince(submitStart);
+		commands.submit(state, GL_TRIANGLES, GL_UNSIGNED_SHORT);
+		submitMilliseconds += millisecondsSince(submitStart);
+		glFinish();
+	}
+	double indirect{ millisecondsSince(start) / frames };
+	std::cout << "  " << objects << " objects, per-object draws " << perObjectSubmit << " ms submit / " << perObject
+		<< " ms frame, " << (commands.multiDraw() ? "multi-draw indirect " : "indirect fallback ")
+		<< submitMilliseconds / frames << " ms submit (" << buildMilliseconds / frames << " ms building commands) / "
+		<< indirect << " ms frame" << std::endl;
+	std::vector<unsigned char> cpuPixels((std::size_t)options.width * options.height * 4);
+	glReadPixels(0, 0, options.width, options.height, GL_RGBA, GL_UNSIGNED_BYTE, cpuPixels.data());
+
+	// The same list written on the GPU, as a culling pass would: commands and
+	// count are copied into place buffer to buffer and the CPU list is cleared,
+	// so submitCount() has to draw what the GPU holds
+	unsigned int gpuCommands, parameters;
+	GLuint drawCount{ (GLuint)objects };
+	glGenBuffers(1, &gpuCommands);
+	glGenBuffers(1, &parameters);
+	state.bindBuffer(GL_COPY_READ_BUFFER, gpuCommands);
+	glBufferData(GL_COPY_READ_BUFFER, objects * sizeof(DrawElementsIndirectCommand), NULL, GL_STATIC_DRAW);
+	state.bindBuffer(GL_COPY_WRITE_BUFFER, parameters);
+	glBufferData(GL_COPY_WRITE_BUFFER, sizeof(drawCount), &drawCount, GL_STATIC_DRAW);
+	std::vector<DrawElementsIndirectCommand> list(objects);
+	for (int i{ 0 }; i < objects; ++i)
+		list[i] = DrawElementsIndirectCommand{ 6, 1, 0, 0, (GLuint)i };
+	glBufferSubData(GL_COPY_READ_BUFFER, 0, objects * sizeof(DrawElementsIndirectCommand), list.data());
+	state.bindBuffer(GL_COPY_WRITE_BUFFER, commands.buffer());
+	glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, objects * sizeof(DrawElementsIndirectCommand));
+	commands.clear();
+	start = Clock::now();
+	glClear(GL_COLOR_BUFFER_BIT);
+	commands.submitCount(state, GL_TRIANGLES, GL_UNSIGNED_SHORT, parameters, 0, objects);
+	glFinish();
+	double gpuWritten{ millisecondsSince(start) };
+	std::vector<unsigned char> gpuPixels(cpuPixels.size());
+	glReadPixels(0, 0, options.width, options.height, GL_RGBA, GL_UNSIGNED_BYTE, gpuPixels.data());
+	bool identical{ cpuPixels == gpuPixels };
+	std::cout << "  GPU-written list, " << (commands.drawCount() ? "GPU draw count " : commands.multiDraw() ? "count read back " : "commands read back ")
+		<< gpuWritten << " ms frame" << std::endl;
+	if (!identical)
+		std::cout << "  GPU-written frame differs from the CPU-built one" << std::endl;
+
+	glDeleteBuffers(1, &gpuCommands);
+	glDeleteBuffers(1, &parameters);
+	commands.destroy();
+	instanceBuffer.destroy();
+	glDeleteVertexArrays(1, &VAO);
+	glDeleteBuffers(1, &VBO);
+	glDeleteBuffers(1, &EBO);
+	glDeleteProgram(program);
+	return identical;
+}
+
+// STREAMING BENCHMARK
+// -------------------
+// Rewriting every instance every frame (think particles): InstanceBuffer
+// orphaning plus glBufferSubData against writing straight into a persistently
+// mapped RingBuffer and selecting the frame's slice with baseInstance.
+static bool benchmarkStreaming(const BenchmarkOptions& options)
+{
+	Context context{};
+	TriangleScene orphanScene{};
+	TriangleScene ringScene{};
+	if (!createHeadlessContext(context, options) || !orphanScene.create() || !ringScene.create())
+		return false;
+	unsigned int program{ compileInstancedProgram() };
+	if (program == 0)
+		return false;
+	const int objects{ 50000 };
+	std::vector<InstanceData> instances{ randomInstances(objects, 0.002f) };
+	const int frames{ options.frames < 200 ? options.frames : 200 };
+	auto animate{ [&instances](int frame)
+	{
+		for (InstanceData& instance : instances)
+			instance.rotation += 0.01f * (float)(frame % 3);
+	} };
+
+	InstanceBuffer instanceBuffer{};
+	RenderStateCache state{};
+	if (!instanceBuffer.create(objects))
+		return false;
+	instanceBuffer.attach(state, orphanScene.VAO, 1);
+	state.useProgram(program);
+	double writeMilliseconds{ 0.0 };
+	Clock::time_point start{ Clock::now() };
+	for (int f{ 0 }; f < frames; ++f)
+	{
+		animate(f);
+		glClear(GL_COLOR_BUFFER_BIT);
+		Clock::time_point writeStart{ Clock::now() };
+		instanceBuffer.clear();
+		for (const InstanceData& instance : instances)
+			instanceBuffer.push(instance);
+		instanceBuffer.upload(state);
+		writeMilliseconds += millisecondsSince(writeStart);
+		instanceBuffer.drawArrays(GL_TRIANGLES, 0, 3);
+		context.swapBuffers();
+	}
+	glFinish();
+	double orphaned{ millisecondsSince(start) / frames };
+	double orphanedWrite{ writeMilliseconds / frames };
+	instanceBuffer.destroy();
+
+	RingBuffer ring{};
+	if (!ring.create(state, GL_ARRAY_BUFFER, objects * sizeof(InstanceData)))
+		return false;
+	attachInstanceAttributes(state, ringScene.VAO, ring.buffer(), 1);
+	state.useProgram(program);
+	state.bindVertexArray(ringScene.VAO);
+	writeMilliseconds = 0.0;
+	start = Clock::now();
+	for (int f{ 0 }; f < frames; ++f)
+	{
+		animate(f);
+		glClear(GL_COLOR_BUFFER_BIT);
+		Clock::time_point writeStart{ Clock::now() };
+		ring.beginFrame();
+		RingAllocation allocation{ ring.allocate(objects * sizeof(InstanceData), sizeof(InstanceData)) };
+		if (allocation.data == nullptr)
+			return false;
+		std::memcpy(allocation.data, instances.data(), allocation.size);
+		ring.flush(state);
+		writeMilliseconds += millisecondsSince(writeStart);
+		glDrawArraysInstancedBaseInstance(GL_TRIANGLES, 0, 3, objects, (GLuint)(allocation.offset / sizeof(InstanceData)));
+		ring.endFrame();
+		context.swapBuffers();
+	}
+	glFinish();
+	double ringFrame{ millisecondsSince(start) / frames };
+	std::cout << "  " << objects << " instances rewritten per frame, orphaning " << orphanedWrite << " ms write / "
+		<< orphaned << " ms frame, " << (ring.persistent() ? "persistent ring " : "ring (buffer updates) ")
+		<< writeMilliseconds / frames << " ms write / " << ringFrame << " ms frame, " << ring.stats().stalls
+		<< " fence stalls" << std::endl;
+
+	ring.destroy();
+	glDeleteProgram(program);
+	orphanScene.destroy();
+	ringScene.destroy();
+	return true;
+}
+
+// HEAP BENCHMARK
+// --------------
+// Many small meshes (random polygons), each with its own vertex array and
+// buffers against all of them packed into one BufferHeap, both drawn through
+// the RenderQueue. Then churn the heap to see how its free space fragments.
+static void polygonMesh(std::mt19937& random, std::vector<float>& vertices, std::vector<std::uint32_t>& indices)
+{
+	std::uniform_real_distribution<float> unit{ 0.0f, 1.0f };
+	int sides{ 3 + (int)(random() % 30) };
+	float x{ unit(random) * 2.0f - 1.0f };
+	float y{ unit(random) * 2.0f - 1.0f };
+	float radius{ 0.005f + unit(random) * 0.01f };
+	vertices.assign({ x, y, 0.0f });
+	indices.clear();
+	for (int i{ 0 }; i < sides; ++i)
+	{
+		float angle{ 6.2831853f * (float)i / (float)sides };
+		vertices.insert(vertices.end(), { x + radius * std::cos(angle), y + radius * std::sin(angle), 0.0f });
+		indices.insert(indices.end(), { 0u, (std::uint32_t)i + 1, (std::uint32_t)(i + 1) % sides + 1 });
+	}
+}
+
+static bool benchmarkHeap(const BenchmarkOptions& options)
+{
+	Context context{};
+	TriangleScene scene{};
+	if (!createHeadlessContext(context, options) || !scene.create())
+		return false;
+	const int meshes{ 5000 };
+	std::mt19937 random{ 1234 };
+	std::vector<float> vertices{};
+	std::vector<std::uint32_t> indices{};
+
+	std::vector<unsigned int> objects(meshes * 3);
+	std::vector<DrawItem> separate(meshes);
+	RenderStateCache state{};
+	BufferHeap heap{};
+	if (!heap.create(state, 3 * sizeof(float), meshes * 20, meshes * 60))
+		return false;
+	heap.setAttribute(state, 0, 3, GL_FLOAT, false, 0);
+	std::vector<MeshAllocation> allocations(meshes);
+	std::vector<DrawItem> packed(meshes);
+	for (int i{ 0 }; i < meshes; ++i)
+	{
+		polygonMesh(random, vertices, indices);
+		unsigned int* VAO{ &objects[i * 3] };
+		glGenVertexArrays(1, VAO);
+		glGenBuffers(2, VAO + 1);
+		state.bindVertexArray(*VAO);
+		state.bindBuffer(GL_ARRAY_BUFFER, VAO[1]);
+		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GL_FLOAT), (void*)0);
+		glEnableVertexAttribArray(0);
+		state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, VAO[2]);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(std::uint32_t), indices.data(), GL_STATIC_DRAW);
+		separate[i].program = scene.program;
+		separate[i].vertexArray = *VAO;
+		separate[i].indexType = GL_UNSIGNED_INT;
+		separate[i].count = (int)indices.size();
+		separate[i].key = makeSortKey(0, scene.program, 0, *VAO, 0.0f);
+
+		allocations[i] = heap.allocate(state, vertices.data(), (std::uint32_t)vertices.size() / 3, indices.data(), (std::uint32_t)indices.size());
+		if (!allocations[i].valid())
+			return false;
+		packed[i] = heap.drawItem(allocations[i], scene.program);
+		packed[i].key = makeSortKey(0, scene.program, 0, heap.vertexArray(), 0.0f);
+	}
+
+	const int frames{ options.frames < 60 ? options.frames : 60 };
+	RenderQueue queue{};
+	auto run{ [&](const std::vector<DrawItem>& items)
+	{
+		state.invalidate();
+		Clock::time_point start{ Clock::now() };
+		for (int f{ 0 }; f < frames; ++f)
+		{
+			state.beginFrame();
+			glClear(GL_COLOR_BUFFER_BIT);
+			for (const DrawItem& item : items)
+				queue.submit(item);
+			queue.flush(state);
+			glFinish();
+		}
+		return millisecondsSince(start) / frames;
+	} };
+	double separateFrame{ run(separate) };
+	long long separateIssued{ state.frame().issued };
+	double packedFrame{ run(packed) };
+	std::cout << "  " << meshes << " meshes, separate buffers " << separateFrame << " ms/frame (" << separateIssued
+		<< " state calls), buffer heap " << packedFrame << " ms/frame (" << state.frame().issued << " state calls)" << std::endl;
+
+	// Replace random meshes with new ones of other sizes, as streaming a level would
+	for (int round{ 0 }; round < 20; ++round)
+	{
+		for (int i{ 0 }; i < meshes / 4; ++i)
+			heap.free(allocations[random() % meshes]);
+		for (MeshAllocation& allocation : allocations)
+		{
+			if (allocation.valid())
+				continue;
+			polygonMesh(random, vertices, indices);
+			allocation = heap.allocate(state, vertices.data(), (std::uint32_t)vertices.size() / 3, indices.data(), (std::uint32_t)indices.size());
+		}
+	}
+	std::cout << "  after churn: ";
+	heap.printStats();
+
+	heap.destroy();
+	for (int i{ 0 }; i < meshes; ++i)
+	{
+		glDeleteVertexArrays(1, &objects[i * 3]);
+		glDeleteBuffers(2, &objects[i * 3 + 1]);
+	}
+	scene.destroy();
+	return true;
+}
+
+// MESH BENCHMARK
+// --------------
+// A finely tessellated sphere delivered as a triangle soup in random triangle
+// order: drawn as-is with glDrawArrays against deduplicated and optimized
+// (vertex cache, overdraw, vertex fetch) with glDrawElements. llvmpipe shades
+// vertices on the CPU, so every cache miss saved shows up in the frame time.
+static bool benchmarkMesh(const BenchmarkOptions& options)
+{
+	Context context{};
+	TriangleScene scene{};
+	if (!createHeadlessContext(context, options) || !scene.create())
+		return false;
+	const int rings{ 256 };
+	const int segments{ 512 };
+	auto spherePoint{ [](int ring, int segment, float* point)
+	{
+		float theta{ 3.14159265f * (float)ring / (float)rings };
+		float phi{ 6.2831853f * (float)(segment % segments) / (float)segments };
+		point[0] = 0.8f * std::sin(theta) * std::cos(phi);
+		point[1] = 0.8f * std::cos(theta);
+		point[2] = 0.8f * std::sin(theta) * std::sin(phi);
+	} };
+	std::vector<float> soup{};
+	std::mt19937 random{ 1234 };
+	{
+		std::vector<int> quads(rings * segments);
+		for (int i{ 0 }; i < rings * segments; ++i)
+			quads[i] = i;
+		std::shuffle(quads.begin(), quads.end(), random);
+		for (int quad : quads)
+		{
+			int ring{ quad / segments };
+			int segment{ quad % segments };
+			float corners[4][3];
+			spherePoint(ring, segment, corners[0]);
+			spherePoint(ring + 1, segment, corners[1]);
+			spherePoint(ring + 1, segment + 1, corners[2]);
+			spherePoint(ring, segment + 1, corners[3]);
+			for (int corner : { 0, 1, 2, 2, 3, 0 })
+				soup.insert(soup.end(), corners[corner], corners[corner] + 3);
+		}
+	}
+	// Handed over unindexed, so the report's "before" is the soup as glDrawArrays would draw it
+	std::uint32_t soupVertices{ (std::uint32_t)(soup.size() / 3) };
+	IndexedMesh mesh{};
+	mesh.vertices = soup;
+	mesh.indices.resize(soupVertices);
+	for (std::uint32_t i{ 0 }; i < soupVertices; ++i)
+		mesh.indices[i] = i;
+	Clock::time_point start{ Clock::now() };
+	MeshOptimizationReport report{ optimizeMesh(mesh) };
+	double optimizeMilliseconds{ millisecondsSince(start) };
+	std::cout << "  " << mesh.triangleCount() << " triangles (" << soupVertices << " soup vertices) optimized in " << optimizeMilliseconds << " ms" << std::endl;
+	std::cout << "  ";
+	printReport(report);
+
+	unsigned int buffers[3];
+	unsigned int vertexArrays[2];
+	glGenBuffers(3, buffers);
+	glGenVertexArrays(2, vertexArrays);
+	glBindVertexArray(vertexArrays[0]);
+	glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+	glBufferData(GL_ARRAY_BUFFER, soup.size() * sizeof(float), soup.data(), GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GL_FLOAT), (void*)0);
+	glEnableVertexAttribArray(0);
+	glBindVertexArray(vertexArrays[1]);
+	glBindBuffer(GL_ARRAY_BUFFER, buffers[1]);
+	glBufferData(GL_ARRAY_BUFFER, mesh.vertices.size() * sizeof(float), mesh.vertices.data(), GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GL_FLOAT), (void*)0);
+	glEnableVertexAttribArray(0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[2]);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(std::uint32_t), mesh.indices.data(), GL_STATIC_DRAW);
+
+	glUseProgram(scene.program);
+	glEnable(GL_DEPTH_TEST);
+	const int frames{ options.frames < 30 ? options.frames : 30 };
+	auto run{ [&](bool indexed)
+	{
+		Clock::time_point runStart{ Clock::now() };
+		for (int f{ 0 }; f < frames; ++f)
+		{
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+			if (indexed)
+				glDrawElements(GL_TRIANGLES, (GLsizei)mesh.indices.size(), GL_UNSIGNED_INT, (void*)0);
+			else
+				glDrawArrays(GL_TRIANGLES, 0, (GLsizei)soupVertices);
+			glFinish();
+		}
+		return millisecondsSince(runStart) / frames;
+	} };
+	glBindVertexArray(vertexArrays[0]);
+	double soupFrame{ run(false) };
+	glBindVertexArray(vertexArrays[1]);
+	double optimizedFrame{ run(true) };
+	glDisable(GL_DEPTH_TEST);
+	std::cout << "  soup " << soupFrame << " ms/frame, optimized indexed " << optimizedFrame << " ms/frame" << std::endl;
+
+	glDeleteVertexArrays(2, vertexArrays);
+	glDeleteBuffers(3, buffers);
+	scene.destroy();
+	return true;
+}
+
+// VERTEX FORMAT BENCHMARK
+// -----------------------
+// A sphere with positions, normals and UVs, stored as full floats (32 bytes
+// per vertex) against the compressed layout (16 bytes: snorm16 positions,
+// octahedral normals, half UVs). Also reports the worst quantization error.
+static bool benchmarkVertexFormat(const BenchmarkOptions& options)
+{
+	Context context{};
+	if (!createHeadlessContext(context, options))
+		return false;
+	const int rings{ 512 };
+	const int segments{ 1024 };
+	std::vector<float> vertices{};
+	std::vector<std::uint32_t> indices{};
+	for (int ring{ 0 }; ring <= rings; ++ring)
+	{
+		for (int segment{ 0 }; segment <= segments; ++segment)
+		{
+			float theta{ 3.14159265f * (float)ring / (float)rings };
+			float phi{ 6.2831853f * (float)segment / (float)segments };
+			float normal[3]{ std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi) };
+			vertices.insert(vertices.end(), { 0.8f * normal[0], 0.8f * normal[1], 0.8f * normal[2], normal[0], normal[1], normal[2],
+				(float)segment / (float)segments, (float)ring / (float)rings });
+		}
+	}
+	for (int ring{ 0 }; ring < rings; ++ring)
+	{
+		for (int segment{ 0 }; segment < segments; ++segment)
+		{
+			std::uint32_t a{ (std::uint32_t)(ring * (segments + 1) + segment) };
+			std::uint32_t b{ a + segments + 1 };
+			indices.insert(indices.end(), { a, b, b + 1, b + 1, a + 1, a });
+		}
+	}
+	VertexSource source{};
+	source.positions = vertices.data();
+	source.normals = vertices.data() + 3;
+	source.texCoords = vertices.data() + 6;
+	source.floatStride = 8;
+	source.count = (std::uint32_t)(vertices.size() / 8);
+
+	// Round trip error of the compressed encodings
+	float positionError{ 0.0f };
+	float normalError{ 0.0f };
+	float texCoordError{ 0.0f };
+	for (std::uint32_t v{ 0 }; v < source.count; ++v)
+	{
+		const float* vertex{ &vertices[(std::size_t)v * 8] };
+		float encoded[2];
+		float decoded[3];
+		octahedralEncode(vertex + 3, encoded);
+		float quantized[2]{ floatToSnorm16(encoded[0]) / 32767.0f, floatToSnorm16(encoded[1]) / 32767.0f };
+		octahedralDecode(quantized, decoded);
+		float cosine{ decoded[0] * vertex[3] + decoded[1] * vertex[4] + decoded[2] * vertex[5] };
+		normalError = std::max(normalError, std::acos(std::min(cosine, 1.0f)) * 57.29578f);
+		for (int c{ 0 }; c < 2; ++c)
+			texCoordError = std::max(texCoordError, std::fabs(halfToFloat(floatToHalf(vertex[6 + c])) - vertex[6 + c]));
+		for (int axis{ 0 }; axis < 3; ++axis)
+			positionError = std::max(positionError, std::fabs(floatToSnorm16(vertex[axis] / 0.8f) / 32767.0f * 0.8f - vertex[axis]));
+	}
+	std::cout << "  max error: position " << positionError << ", normal " << normalError << " degrees, uv " << texCoordError << std::endl;
+
+	std::string fullVertex{ "#version 330 core\n"
+		"layout(location = 0) in vec3 aPos;\n"
+		"layout(location = 1) in vec3 aNormal;\n"
+		"layout(location = 2) in vec2 aTexCoord;\n"
+		"out vec3 color;\n"
+		"void main() { color = (aNormal * 0.5 + 0.5) * vec3(aTexCoord, 1.0); gl_Position = vec4(aPos, 1.0); }\n" };
+	std::string compressedVertex{ std::string{ "#version 330 core\n"
+		"layout(location = 0) in vec4 aPos;\n"
+		"layout(location = 1) in vec2 aNormal;\n"
+		"layout(location = 2) in vec2 aTexCoord;\n"
+		"uniform vec3 positionScale;\n"
+		"uniform vec3 positionOffset;\n"
+		"out vec3 color;\n" } + OCTAHEDRAL_DECODE_GLSL
+		+ "void main() { color = (octahedralDecode(aNormal) * 0.5 + 0.5) * vec3(aTexCoord, 1.0);"
+		" gl_Position = vec4(aPos.xyz * positionScale + positionOffset, 1.0); }\n" };
+	const char* fragment{
+		"#version 330 core\n"
+		"in vec3 color;\n"
+		"out vec4 FragColor;\n"
+		"void main() { FragColor = vec4(color, 1.0); }\n" };
+
+	struct Variant
+	{
+		const char* name;
+		VertexLayout layout;
+		std::string vertexSource;
+		Program program{};
+		Buffer vertexBuffer{};
+		VertexArray vertexArray{};
+	};
+	Variant variants[2]{ { "float", VertexLayout::full(), fullVertex }, { "compressed", VertexLayout::compressed(), compressedVertex } };
+	Buffer indexBuffer{};
+	if (!indexBuffer.create(indices.size() * sizeof(std::uint32_t), indices.data()))
+		return false;
+	for (Variant& variant : variants)
+	{
+		PackedVertices packed{ variant.layout.pack(source) };
+		if (!variant.program.create(variant.vertexSource.c_str(), fragment) || !variant.vertexArray.create()
+			|| !variant.vertexBuffer.create((GLsizeiptr)packed.data.size(), packed.data.data()))
+			return false;
+		variant.layout.apply(variant.vertexArray, 0, variant.vertexBuffer);
+		variant.vertexArray.setIndexBuffer(indexBuffer);
+		int scale{ variant.program.uniformLocation("positionScale") };
+		int offset{ variant.program.uniformLocation("positionOffset") };
+		if (scale >= 0)
+			variant.program.setUniform(scale, packed.positionScale[0], packed.positionScale[1], packed.positionScale[2]);
+		if (offset >= 0)
+			variant.program.setUniform(offset, packed.positionOffset[0], packed.positionOffset[1], packed.positionOffset[2]);
+	}
+
+	const int frames{ options.frames < 20 ? options.frames : 20 };
+	glEnable(GL_DEPTH_TEST);
+	std::cout << "  " << source.count << " vertices, " << indices.size() / 3 << " triangles" << std::endl;
+	for (Variant& variant : variants)
+	{
+		glUseProgram(variant.program.id());
+		glBindVertexArray(variant.vertexArray.id());
+		Clock::time_point start{ Clock::now() };
+		for (int f{ 0 }; f < frames; ++f)
+		{
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+			glDrawElements(GL_TRIANGLES, (GLsizei)indices.size(), GL_UNSIGNED_INT, (void*)0);
+			glFinish();
+		}
+		std::cout << "  " << variant.name << ": " << variant.layout.stride() << " bytes/vertex, "
+			<< variant.vertexBuffer.size() / 1024 << " KiB, " << millisecondsSince(start) / frames << " ms/frame" << std::endl;
+	}
+	glDisable(GL_DEPTH_TEST);
+	glBindVertexArray(0);
+	return true;
+}
+
+// PROFILER BENCHMARK
+// ------------------
+// Cost of one PROFILE_SCOPE zone with recording disabled and enabled, and of
+// writing the resulting trace.
+static bool benchmarkProfiler(const BenchmarkOptions& options)
+{
+	// Needs no context, so none of the options apply
+	(void)options;
+	const int zones{ 1000000 };
+	volatile int sink{ 0 };
+	auto run{ [&]()
+	{
+		Clock::time_point start{ Clock::now() };
+		for (int i{ 0 }; i < zones; ++i)
+		{
+			PROFILE_SCOPE("Benchmark zone");
+			sink = sink + 1;
+		}
+		return millisecondsSince(start) * 1000000.0 / zones;
+	} };
+	Profiler::setEnabled(false);
+	double disabled{ run() };
+	Profiler::setEnabled(true);
+	double enabled{ run() };
+	Profiler::setEnabled(false);
+	std::cout << "  " << disabled << " ns/zone disabled, " << enabled << " ns/zone enabled" << std::endl;
+	Clock::time_point start{ Clock::now() };
+	bool written{ Profiler::writeChromeTrace("benchmark_profile.json") };
+	std::cout << "  trace written in " << millisecondsSince(start) << " ms" << std::endl;
+	Profiler::clear();
+	std::remove("benchmark_profile.json");
+	return written;
+}
+
+// COMMAND LIST BENCHMARK
+// ----------------------
+// The per-object instancing scene with some per-object work (animating the
+// transform, rejecting objects off screen) done every frame. Direct: the GL
+// thread does the work and issues the draws itself. Recorded: jobs do the work
+// and record the draws into one CommandList per chunk of objects, then the GL
+// thread replays the lists in order.
+static bool animateInstance(const InstanceData& instance, int frame, float* transform)
+{
+	float angle{ instance.rotation + frame * 0.01f };
+	transform[0] = instance.offset[0] + 0.05f * std::sin(angle * 3.0f);
+	transform[1] = instance.offset[1] + 0.05f * std::cos(angle * 2.0f);
+	transform[2] = instance.scale * (1.0f + 0.25f * std::sin(angle));
+	transform[3] = angle;
+	return std::fabs(transform[0]) - transform[2] < 1.0f && std::fabs(transform[1]) - transform[2] < 1.0f;
+}
+static bool benchmarkCommands(const BenchmarkOptions& options)
+{
+	Context context{};
+	TriangleScene scene{};
+	if (!createHeadlessContext(context, options) || !scene.create())
+		return false;
+	std::string vertexSource{ std::string{ "#version 330 core\n"
+		"layout(location = 0) in vec3 aPos;\n"
+		"uniform vec4 transform;\n"
+		"uniform vec4 tint;\n"
+		"out vec4 color;\n" } + PLACE_FUNCTION
+		+ "void main() { color = tint; gl_Position = vec4(place(aPos, transform), 0.0, 1.0); }\n" };
+	unsigned int program{ compileProgram(vertexSource.c_str(), COLOR_FRAGMENT) };
+	if (program == 0)
+		return false;
+	int transformLocation{ glGetUniformLocation(program, "transform") };
+	int tintLocation{ glGetUniformLocation(program, "tint") };
+	JobSystem jobs{};
+	if (!jobs.create(options.threads > 1 ? options.threads - 1 : 0))
+		return false;
+
+	const int objects{ 10000 };
+	const int chunkSize{ 256 };
+	const int chunks{ (objects + chunkSize - 1) / chunkSize };
+	std::vector<InstanceData> instances{ randomInstances(objects, 0.02f) };
+	const int frames{ options.frames < 20 ? options.frames : 20 };
+	DrawItem item{};
+	item.program = program;
+	item.vertexArray = scene.VAO;
+	item.count = 3;
+
+	RenderStateCache state{};
+	Clock::time_point start{ Clock::now() };
+	for (int f{ 0 }; f < frames; ++f)
+	{
+		glClear(GL_COLOR_BUFFER_BIT);
+		for (const InstanceData& instance : instances)
+		{
+			float transform[4];
+			if (!animateInstance(instance, f, transform))
+				continue;
+			state.useProgram(program);
+			state.bindVertexArray(scene.VAO);
+			glUniform4fv(transformLocation, 1, transform);
+			glUniform4fv(tintLocation, 1, instance.color);
+			drawItem(item, item.count);
+		}
+		glFinish();
+	}
+	double direct{ millisecondsSince(start) / frames };
+	std::vector<unsigned char> directPixels((std::size_t)options.width * options.height * 4);
+	glReadPixels(0, 0, options.width, options.height, GL_RGBA, GL_UNSIGNED_BYTE, directPixels.data());
+
+	std::vector<CommandList> lists(chunks);
+	double recordMilliseconds{ 0.0 };
+	state.invalidate();
+	start = Clock::now();
+	for (int f{ 0 }; f < frames; ++f)
+	{
+		Clock::time_point recordStart{ Clock::now() };
+		jobs.parallelFor(0, chunks, 1, [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t chunk{ begin }; chunk < end; ++chunk)
+			{
+				CommandList& list{ lists[chunk] };
+				list.reset();
+				// Lists replay one after another, bind the program the uniforms go to
+				list.useProgram(program);
+				int last{ std::min((int)(chunk + 1) * chunkSize, objects) };
+				for (int i{ (int)chunk * chunkSize }; i < last; ++i)
+				{
+					float transform[4];
+					if (!animateInstance(instances[i], f, transform))
+						continue;
+					list.setUniform(transformLocation, transform[0], transform[1], transform[2], transform[3]);
+					list.setUniform(tintLocation, instances[i].color[0], instances[i].color[1], instances[i].color[2], instances[i].color[3]);
+					list.draw(item);
+				}
+			}
+		});
+		recordMilliseconds += millisecondsSince(recordStart);
+		glClear(GL_COLOR_BUFFER_BIT);
+		for (const CommandList& list : lists)
+			list.execute(state);
+		glFinish();
+	}
+	double recorded{ millisecondsSince(start) / frames };
+	std::vector<unsigned char> recordedPixels(directPixels.size());
+	glReadPixels(0, 0, options.width, options.height, GL_RGBA, GL_UNSIGNED_BYTE, recordedPixels.data());
+	bool identical{ directPixels == recordedPixels };
+	std::size_t bytes{ 0 };
+	int commands{ 0 };
+	for (const CommandList& list : lists)
+	{
+		bytes += list.bytes();
+		commands += list.size();
+	}
+	std::cout << "  " << objects << " objects, direct " << direct << " ms/frame, recorded on " << jobs.threadCount() << " threads "
+		<< recorded << " ms/frame (" << recordMilliseconds / frames << " ms recording, " << commands << " commands in "
+		<< chunks << " lists, " << bytes / 1024 << " KiB)" << std::endl;
+	if (!identical)
+		std::cout << "  recorded frame differs from the direct one" << std::endl;
+	glDeleteProgram(program);
+	scene.destroy();
+	return identical;
+}
+
+// FRAME PIPELINE BENCHMARK
+// ------------------------
+// A frame with a fixed amount of simulation work (animating every object a
+// few times over) and of render work (screen filling draws), run through a FramePipeline
+// of depth 1 (simulate, then render), 2 and 3. Reports frame time and the
+// latency from the start of a frame's simulation to its present.
+static bool benchmarkPipeline(const BenchmarkOptions& options)
+{
+	Context context{};
+	TriangleScene scene{};
+	if (!createHeadlessContext(context, options) || !scene.create())
+		return false;
+	const int objects{ 2000 };
+	const int draws{ 100 };
+	std::vector<InstanceData> instances{ randomInstances(objects, 0.02f) };
+	struct SimulatedFrame
+	{
+		std::vector<float> transforms{};
+	};
+	const int frames{ options.frames < 60 ? options.frames : 60 };
+	for (int depth{ 1 }; depth <= 3; ++depth)
+	{
+		std::vector<SimulatedFrame> slots(depth);
+		FramePipeline pipeline{};
+		pipeline.create(depth, [&](int slot, long long frame)
+		{
+			std::vector<float>& transforms{ slots[slot].transforms };
+			transforms.resize(objects * 4);
+			// Stands in for game logic: several passes over every object
+			for (int pass{ 0 }; pass < 32; ++pass)
+			{
+				for (int i{ 0 }; i < objects; ++i)
+					animateInstance(instances[i], (int)frame + pass, &transforms[i * 4]);
+			}
+		});
+		glUseProgram(scene.program);
+		glBindVertexArray(scene.VAO);
+		Clock::time_point start{ Clock::now() };
+		for (int f{ 0 }; f < frames; ++f)
+		{
+			int slot{ pipeline.beginRender() };
+			glClear(GL_COLOR_BUFFER_BIT);
+			for (int i{ 0 }; i < draws; ++i)
+			{
+				if (slots[slot].transforms[i * 4 + 2] > 0.0f)
+					glDrawArrays(GL_TRIANGLES, 0, 3);
+			}
+			glFinish();
+			pipeline.endRender(slot);
+		}
+		double elapsed{ millisecondsSince(start) / frames };
+		pipeline.destroy();
+		FramePipelineStats stats{ pipeline.stats() };
+		std::cout << "  depth " << depth << ": " << elapsed << " ms/frame, latency " << stats.averageLatency() << " ms average, "
+			<< stats.maxLatencyMilliseconds << " ms max, render waited " << stats.renderWaitMilliseconds / stats.frames
+			<< " ms/frame" << std::endl;
+	}
+	scene.destroy();
+	return true;
+}
+
+// ASSET LOADER BENCHMARK
+// ----------------------
+// Writes a set of PPM textures and OBJ grids, then loads them twice: waiting
+// for all of them up front, and streaming them in while a render loop keeps
+// going. The render loop's worst frame shows whether loading caused hitches.
+static bool writeAssets(const std::string& directory, int textures, int meshes, std::vector<std::string>& paths)
+{
+	const int size{ 512 };
+	for (int t{ 0 }; t < textures; ++t)
+	{
+		std::string path{ directory + "_texture" + std::to_string(t) + ".ppm" };
+		std::ofstream file{ path, std::ios::binary };
+		file << "P6\n" << size << " " << size << "\n255\n";
+		std::vector<char> pixels((std::size_t)size * size * 3);
+		for (int i{ 0 }; i < size * size; ++i)
+		{
+			pixels[i * 3] = (char)(i % size);
+			pixels[i * 3 + 1] = (char)(i / size);
+			pixels[i * 3 + 2] = (char)(t * 16);
+		}
+		file.write(pixels.data(), pixels.size());
+		if (!file)
+			return false;
+		paths.push_back(path);
+	}
+	const int grid{ 128 };
+	for (int m{ 0 }; m < meshes; ++m)
+	{
+		std::string path{ directory + "_mesh" + std::to_string(m) + ".obj" };
+		std::ofstream file{ path };
+		for (int y{ 0 }; y <= grid; ++y)
+		{
+			for (int x{ 0 }; x <= grid; ++x)
+				file << "v " << x << " " << std::sin(x * 0.1f + m) * std::cos(y * 0.1f) << " " << y << "\nvt " << (float)x / grid << " " << (float)y / grid << "\n";
+		}
+		for (int y{ 0 }; y < grid; ++y)
+		{
+			for (int x{ 0 }; x < grid; ++x)
+			{
+				int a{ y * (grid + 1) + x + 1 };
+				int b{ a + grid + 1 };
+				file << "f " << a << "/" << a << " " << a + 1 << "/" << a + 1 << " " << b + 1 << "/" << b + 1 << " " << b << "/" << b << "\n";
+			}
+		}
+		if (!file)
+			return false;
+		paths.push_back(path);
+	}
+	return true;
+}
+static void requestAssets(AssetLoader& loader, const std::vector<std::string>& paths)
+{
+	for (const std::string& path : paths)
+	{
+		if (path.compare(path.size() - 4, 4, ".obj") == 0)
+			loader.loadMesh(path);
+		else
+			loader.loadTexture(path);
+	}
+}
+static bool benchmarkAssets(const BenchmarkOptions& options)
+{
+	Context context{};
+	TriangleScene scene{};
+	if (!createHeadlessContext(context, options) || !scene.create())
+		return false;
+	std::vector<std::string> paths{};
+	bool written{ writeAssets("benchmark_asset", 16, 8, paths) };
+	auto renderFrame{ [&]()
+	{
+		Clock::time_point start{ Clock::now() };
+		for (int i{ 0 }; i < 20; ++i)
+			scene.draw();
+		glFinish();
+		return millisecondsSince(start);
+	} };
+
+	bool loaded{ false };
+	if (written)
+	{
+		double baseline{ 0.0 };
+		for (int f{ 0 }; f < 30; ++f)
+			baseline = std::max(baseline, renderFrame());
+
+		JobSystem jobs{};
+		jobs.create(options.threads > 1 ? options.threads - 1 : 0);
+		AssetLoader loader{};
+		loaded = loader.create(context, jobs);
+		Clock::time_point start{ Clock::now() };
+		requestAssets(loader, paths);
+		loader.finishAll();
+		double blocking{ millisecondsSince(start) };
+		loaded = loaded && loader.stats().ready == (int)paths.size();
+		loader.printStats();
+		loader.destroy();
+
+		loaded = loaded && loader.create(context, jobs);
+		start = Clock::now();
+		requestAssets(loader, paths);
+		int frames{ 0 };
+		double worst{ 0.0 };
+		while (loader.pending() > 0)
+		{
+			loader.poll();
+			worst = std::max(worst, renderFrame());
+			++frames;
+		}
+		double streaming{ millisecondsSince(start) };
+		loaded = loaded && loader.stats().ready == (int)paths.size();
+		std::cout << "  " << paths.size() << " assets, waiting for all: main thread blocked " << blocking << " ms; streaming: "
+			<< frames << " frames in " << streaming << " ms, worst frame " << worst << " ms (" << baseline
+			<< " ms without loading), longest poll " << loader.stats().maxPollMilliseconds << " ms" << std::endl;
+	}
+	for (const std::string& path : paths)
+		std::remove(path.c_str());
+	scene.destroy();
+	return loaded;
+}
+
+// JOB SYSTEM BENCHMARK
+// --------------------
+// Throughput of empty jobs submitted from one thread, of a job tree where
+// every job spawns and waits on its children, and a parallelFor transform
+// against the same loop run serially. Steal counts show how the work spread.
+static void spawnTree(JobSystem& jobs, int depth)
+{
+	if (depth == 0)
+		return;
+	JobCounter children{};
+	jobs.run(children, [&jobs, depth] { spawnTree(jobs, depth - 1); });
+	jobs.run(children, [&jobs, depth] { spawnTree(jobs, depth - 1); });
+	jobs.wait(children);
+}
+static void printJobStats(const char* name, const JobSystemStats& stats, double milliseconds)
+{
+	std::cout << "  " << name << ": " << stats.executed << " jobs in " << milliseconds << " ms, "
+		<< stats.executed / milliseconds / 1000.0 << " M jobs/s, " << stats.steals << " steals, "
+		<< stats.failedSteals << " failed steals, " << stats.sleeps << " sleeps" << std::endl;
+}
+static bool benchmarkJobs(const BenchmarkOptions& options)
+{
+	JobSystem jobs{};
+	if (!jobs.create(options.threads > 1 ? options.threads - 1 : 0))
+		return false;
+	std::cout << "  " << jobs.threadCount() << " threads, " << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+
+	// Batches stay below the per thread job pool
+	const int batches{ 200 };
+	const int batchSize{ 2048 };
+	std::atomic<int> sink{ 0 };
+	jobs.resetStats();
+	Clock::time_point start{ Clock::now() };
+	for (int b{ 0 }; b < batches; ++b)
+	{
+		JobCounter counter{};
+		for (int i{ 0 }; i < batchSize; ++i)
+			jobs.run(counter, [&sink] { sink.fetch_add(1, std::memory_order_relaxed); });
+		jobs.wait(counter);
+	}
+	printJobStats("empty jobs", jobs.stats(), millisecondsSince(start));
+
+	jobs.resetStats();
+	start = Clock::now();
+	for (int i{ 0 }; i < 10; ++i)
+		spawnTree(jobs, 14);
+	printJobStats("nested spawn", jobs.stats(), millisecondsSince(start));
+
+	std::vector<float> input(1 << 22);
+	std::vector<float> output(input.size());
+	for (std::size_t i{ 0 }; i < input.size(); ++i)
+		input[i] = (float)i;
+	auto transform{ [&](std::size_t begin, std::size_t end)
+	{
+		for (std::size_t i{ begin }; i < end; ++i)
+			output[i] = std::sqrt(input[i]) * std::sin(input[i]);
+	} };
+	start = Clock::now();
+	transform(0, input.size());
+	double serial{ millisecondsSince(start) };
+	float expected{ output[input.size() / 3] };
+	std::fill(output.begin(), output.end(), 0.0f);
+	jobs.resetStats();
+	start = Clock::now();
+	jobs.parallelFor(0, input.size(), 16384, transform);
+	double parallel{ millisecondsSince(start) };
+	std::cout << "  parallelFor over " << input.size() << " elements: serial " << serial << " ms, parallel " << parallel
+		<< " ms, " << jobs.stats().steals << " ranges stolen" << std::endl;
+	return sink.load() == batches * batchSize && output[input.size() / 3] == expected;
+}
+
+// BENCHMARK LIST
+// --------------
+static const Benchmark benchmarks[]
+{
+	{ "frame", "clear + single triangle render loop", benchmarkFrame },
+	{ "loader", "eager vs lazy GL function loading for a one-frame job", benchmarkLoader },
+	{ "contexts", "independent headless contexts rendering on parallel threads", benchmarkContexts },
+	{ "shaders", "serial vs asynchronous startup shader compilation", benchmarkShaders },
+	{ "queue", "unsorted vs sort-key ordered submission of many small draws", benchmarkQueue },
+	{ "instancing", "draw call per object vs one instanced draw", benchmarkInstancing },
+	{ "indirect", "draw call per object vs one multi-draw indirect submission", benchmarkIndirect },
+	{ "streaming", "orphaned buffer updates vs persistent mapped ring buffer", benchmarkStreaming },
+	{ "heap", "buffers per mesh vs meshes packed into a shared buffer heap", benchmarkHeap },
+	{ "mesh", "triangle soup vs deduplicated, cache and overdraw optimized mesh", benchmarkMesh },
+	{ "vertexformat", "full float vertices vs half/snorm/octahedral compressed vertices", benchmarkVertexFormat },
+	{ "profiler", "cost of a CPU profiler zone and of the Chrome trace export", benchmarkProfiler },
+	{ "jobs", "task throughput and steal rates of the work-stealing job system", benchmarkJobs },
+	{ "commands", "draw submission on the GL thread vs command lists recorded by worker threads", benchmarkCommands },
+	{ "pipeline", "frame time and latency of simulation and rendering pipelined 1, 2 and 3 deep", benchmarkPipeline },
+	{ "assets", "loading textures and meshes up front vs streamed in through a shared upload context", benchmarkAssets },
+};
+
+// MAIN
+// ----
+int main(int argc, char* argv[])
+{
+	BenchmarkOptions options{};
+	std::vector<const char*> selected{};
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			options.frames = std::atoi(argv[++i]);
+		else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+			options.threads = std::atoi(argv[++i]);
+		else if (std::strcmp(argv[i], "--list") == 0)
+		{
+			for (const Benchmark& benchmark : benchmarks)
+				std::cout << benchmark.name << " - " << benchmark.description << std::endl;
+			return 0;
+		}
+		else
+			selected.push_back(argv[i]);
+	}
+
+	int failures{ 0 };
+	for (const Benchmark& benchmark : benchmarks)
+	{
+		bool wanted{ selected.empty() };
+		for (const char* name : selected)
+			wanted = wanted || std::strcmp(name, benchmark.name) == 0;
+		if (!wanted)
+			continue;
+		std::cout << benchmark.name << " (" << benchmark.description << ")" << std::endl;
+		if (!benchmark.run(options))
+		{
+			std::cout << "  FAILED" << std::endl;
+			++failures;
+		}
+	}
+	return failures == 0 ? 0 : 1;
+}
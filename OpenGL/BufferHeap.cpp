@@ -0,0 +1,205 @@
+#include "BufferHeap.h"
+#include "DrawCommandBuffer.h"
+#include "FrameStats.h"
+#include "RenderQueue.h"
+#include "RenderState.h"
+#include <iostream>
+
+// OFFSET ALLOCATOR
+// ----------------
+float OffsetAllocatorStats::fragmentation() const
+{
+	std::uint32_t free{ capacity - used };
+	return free == 0 ? 0.0f : 1.0f - (float)largestFree / (float)free;
+}
+void OffsetAllocator::reset(std::uint32_t capacity)
+{
+	m_capacity = capacity;
+	m_freeByOffset.clear();
+	m_freeBySize.clear();
+	m_allocated.clear();
+	if (capacity > 0)
+		insertFree(0, capacity);
+}
+void OffsetAllocator::insertFree(std::uint32_t offset, std::uint32_t size)
+{
+	m_freeByOffset.emplace(offset, size);
+	m_freeBySize.emplace(size, offset);
+}
+void OffsetAllocator::eraseFree(std::map<std::uint32_t, std::uint32_t>::iterator range)
+{
+	auto sized{ m_freeBySize.equal_range(range->second) };
+	for (auto it{ sized.first }; it != sized.second; ++it)
+	{
+		if (it->second == range->first)
+		{
+			m_freeBySize.erase(it);
+			break;
+		}
+	}
+	m_freeByOffset.erase(range);
+}
+std::uint32_t OffsetAllocator::allocate(std::uint32_t size)
+{
+	if (size == 0)
+		return INVALID;
+	// Best fit: the smallest free range that holds size
+	auto best{ m_freeBySize.lower_bound(size) };
+	if (best == m_freeBySize.end())
+		return INVALID;
+	std::uint32_t offset{ best->second };
+	std::uint32_t rangeSize{ best->first };
+	m_freeBySize.erase(best);
+	m_freeByOffset.erase(offset);
+	if (rangeSize > size)
+		insertFree(offset + size, rangeSize - size);
+	m_allocated.emplace(offset, size);
+	return offset;
+}
+void OffsetAllocator::free(std::uint32_t offset)
+{
+	auto allocation{ m_allocated.find(offset) };
+	if (allocation == m_allocated.end())
+	{
+		std::cout << "Offset allocator: freeing unknown offset " << offset << std::endl;
+		return;
+	}
+	std::uint32_t size{ allocation->second };
+	m_allocated.erase(allocation);
+
+	// Merge with the free ranges directly after and before
+	auto next{ m_freeByOffset.lower_bound(offset) };
+	if (next != m_freeByOffset.end() && next->first == offset + size)
+	{
+		size += next->second;
+		eraseFree(next);
+	}
+	auto previous{ m_freeByOffset.lower_bound(offset) };
+	if (previous != m_freeByOffset.begin())
+	{
+		--previous;
+		if (previous->first + previous->second == offset)
+		{
+			offset = previous->first;
+			size += previous->second;
+			eraseFree(previous);
+		}
+	}
+	insertFree(offset, size);
+}
+OffsetAllocatorStats OffsetAllocator::stats() const
+{
+	OffsetAllocatorStats stats{};
+	stats.capacity = m_capacity;
+	stats.allocations = (int)m_allocated.size();
+	stats.freeRanges = (int)m_freeByOffset.size();
+	std::uint32_t free{ 0 };
+	for (const auto& range : m_freeByOffset)
+		free += range.second;
+	stats.used = m_capacity - free;
+	stats.largestFree = m_freeBySize.empty() ? 0 : m_freeBySize.rbegin()->first;
+	return stats;
+}
+// BUFFER HEAP
+// -----------
+BufferHeap::~BufferHeap()
+{
+	destroy();
+}
+bool BufferHeap::create(RenderStateCache& state, GLsizei vertexStride, std::uint32_t vertexCapacity, std::uint32_t indexCapacity)
+{
+	destroy();
+	m_stride = vertexStride;
+	glGenVertexArrays(1, &m_vertexArray);
+	glGenBuffers(1, &m_vertexBuffer);
+	glGenBuffers(1, &m_indexBuffer);
+	if (m_vertexArray == 0 || m_vertexBuffer == 0 || m_indexBuffer == 0)
+	{
+		std::cout << "Buffer heap failed to create" << std::endl;
+		destroy();
+		return false;
+	}
+	// The index buffer is bound once here and stays part of the vertex array
+	state.bindVertexArray(m_vertexArray);
+	state.bindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+	glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)vertexCapacity * vertexStride, NULL, GL_STATIC_DRAW);
+	state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)indexCapacity * sizeof(std::uint32_t), NULL, GL_STATIC_DRAW);
+	m_vertices.reset(vertexCapacity);
+	m_indices.reset(indexCapacity);
+	return true;
+}
+void BufferHeap::destroy()
+{
+	if (m_vertexArray != 0)
+		glDeleteVertexArrays(1, &m_vertexArray);
+	if (m_vertexBuffer != 0)
+		glDeleteBuffers(1, &m_vertexBuffer);
+	if (m_indexBuffer != 0)
+		glDeleteBuffers(1, &m_indexBuffer);
+	m_vertexArray = m_vertexBuffer = m_indexBuffer = 0;
+	m_vertices.reset(0);
+	m_indices.reset(0);
+}
+void BufferHeap::setAttribute(RenderStateCache& state, unsigned int location, int size, GLenum type, bool normalized, std::size_t offset)
+{
+	state.bindVertexArray(m_vertexArray);
+	state.bindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+	glVertexAttribPointer(location, size, type, normalized ? GL_TRUE : GL_FALSE, m_stride, (void*)offset);
+	glEnableVertexAttribArray(location);
+}
+// MESHES
+// ------
+MeshAllocation BufferHeap::allocate(RenderStateCache& state, const void* vertices, std::uint32_t vertexCount, const std::uint32_t* indices, std::uint32_t indexCount)
+{
+	MeshAllocation mesh{};
+	std::uint32_t firstVertex{ m_vertices.allocate(vertexCount) };
+	if (firstVertex == OffsetAllocator::INVALID)
+		return mesh;
+	std::uint32_t firstIndex{ m_indices.allocate(indexCount) };
+	if (firstIndex == OffsetAllocator::INVALID)
+	{
+		m_vertices.free(firstVertex);
+		return mesh;
+	}
+	mesh = MeshAllocation{ firstVertex, vertexCount, firstIndex, indexCount };
+	// Copy targets so neither the vertex array's element buffer nor GL_ARRAY_BUFFER changes
+	state.bindBuffer(GL_COPY_WRITE_BUFFER, m_vertexBuffer);
+	glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)firstVertex * m_stride, (GLsizeiptr)vertexCount * m_stride, vertices);
+	state.bindBuffer(GL_COPY_WRITE_BUFFER, m_indexBuffer);
+	glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)firstIndex * sizeof(std::uint32_t), (GLsizeiptr)indexCount * sizeof(std::uint32_t), indices);
+	countUpload((long long)vertexCount * m_stride + (long long)indexCount * sizeof(std::uint32_t));
+	return mesh;
+}
+void BufferHeap::free(MeshAllocation& mesh)
+{
+	if (!mesh.valid())
+		return;
+	m_vertices.free(mesh.firstVertex);
+	m_indices.free(mesh.firstIndex);
+	mesh = MeshAllocation{};
+}
+DrawItem BufferHeap::drawItem(const MeshAllocation& mesh, unsigned int program) const
+{
+	DrawItem item{};
+	item.program = program;
+	item.vertexArray = m_vertexArray;
+	item.indexType = GL_UNSIGNED_INT;
+	item.first = (int)mesh.firstIndex;
+	item.count = (int)mesh.indexCount;
+	item.baseVertex = (int)mesh.firstVertex;
+	return item;
+}
+DrawElementsIndirectCommand BufferHeap::command(const MeshAllocation& mesh, std::uint32_t baseInstance) const
+{
+	return DrawElementsIndirectCommand{ mesh.indexCount, 1, mesh.firstIndex, (GLint)mesh.firstVertex, baseInstance };
+}
+void BufferHeap::printStats() const
+{
+	OffsetAllocatorStats vertices{ m_vertices.stats() };
+	OffsetAllocatorStats indices{ m_indices.stats() };
+	std::cout << "Buffer heap: " << vertices.allocations << " meshes, vertices " << vertices.used << "/" << vertices.capacity
+		<< " (" << vertices.freeRanges << " free ranges, " << vertices.fragmentation() * 100.0f << "% fragmented), indices "
+		<< indices.used << "/" << indices.capacity << " (" << indices.freeRanges << " free ranges, "
+		<< indices.fragmentation() * 100.0f << "% fragmented)" << std::endl;
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+struct DrawItem;
+struct DrawElementsIndirectCommand;
+class RenderStateCache;
+
+// OFFSET ALLOCATOR
+// ----------------
+// Hands out ranges of an abstract [0, capacity) space, in units chosen by the
+// caller (vertices, indices). Free ranges live in two maps: by offset, to merge
+// a freed range with its neighbours, and by size, for best-fit lookups.
+struct OffsetAllocatorStats
+{
+	std::uint32_t capacity{ 0 };
+	std::uint32_t used{ 0 };
+	std::uint32_t largestFree{ 0 };
+	int allocations{ 0 };
+	int freeRanges{ 0 };
+	float fragmentation() const; // 0 when all free space is one range, towards 1 when it is scattered
+};
+
+class OffsetAllocator
+{
+public:
+	static constexpr std::uint32_t INVALID{ 0xFFFFFFFFu };
+
+	void reset(std::uint32_t capacity);
+	std::uint32_t allocate(std::uint32_t size); // INVALID when no free range is large enough
+	void free(std::uint32_t offset);
+	OffsetAllocatorStats stats() const;
+
+private:
+	void insertFree(std::uint32_t offset, std::uint32_t size);
+	void eraseFree(std::map<std::uint32_t, std::uint32_t>::iterator range);
+
+	std::uint32_t m_capacity{ 0 };
+	std::map<std::uint32_t, std::uint32_t> m_freeByOffset{};
+	std::multimap<std::uint32_t, std::uint32_t> m_freeBySize{};
+	std::map<std::uint32_t, std::uint32_t> m_allocated{};
+};
+
+// MESH ALLOCATION
+// ---------------
+// firstVertex becomes the draw's baseVertex, so a mesh's indices stay relative
+// to its own vertices.
+struct MeshAllocation
+{
+	std::uint32_t firstVertex{ OffsetAllocator::INVALID };
+	std::uint32_t vertexCount{ 0 };
+	std::uint32_t firstIndex{ OffsetAllocator::INVALID };
+	std::uint32_t indexCount{ 0 };
+	bool valid() const { return firstVertex != OffsetAllocator::INVALID; }
+};
+
+// BUFFER HEAP
+// -----------
+// One large vertex buffer, one large 32-bit index buffer and one vertex array
+// shared by every mesh placed in the heap. Meshes are drawn with base-vertex
+// draws, so switching mesh never rebinds buffers or the vertex array and the
+// driver manages three objects instead of three per mesh.
+// Capacity is fixed at create(); when allocate() fails, start another heap.
+class BufferHeap
+{
+public:
+	~BufferHeap();
+	BufferHeap() = default;
+	BufferHeap(const BufferHeap&) = delete;
+	BufferHeap& operator=(const BufferHeap&) = delete;
+
+	bool create(RenderStateCache& state, GLsizei vertexStride, std::uint32_t vertexCapacity, std::uint32_t indexCapacity);
+	void destroy();
+	// Describe one vertex attribute, offset relative to the start of a vertex
+	void setAttribute(RenderStateCache& state, unsigned int location, int size, GLenum type, bool normalized, std::size_t offset);
+
+	MeshAllocation allocate(RenderStateCache& state, const void* vertices, std::uint32_t vertexCount, const std::uint32_t* indices, std::uint32_t indexCount);
+	void free(MeshAllocation& mesh);
+
+	DrawItem drawItem(const MeshAllocation& mesh, unsigned int program) const; // key left for the caller
+	DrawElementsIndirectCommand command(const MeshAllocation& mesh, std::uint32_t baseInstance = 0) const;
+
+	unsigned int vertexArray() const { return m_vertexArray; }
+	unsigned int vertexBuffer() const { return m_vertexBuffer; }
+	unsigned int indexBuffer() const { return m_indexBuffer; }
+	OffsetAllocatorStats vertexStats() const { return m_vertices.stats(); }
+	OffsetAllocatorStats indexStats() const { return m_indices.stats(); }
+	void printStats() const;
+
+private:
+	GLsizei m_stride{ 0 };
+	unsigned int m_vertexArray{ 0 };
+	unsigned int m_vertexBuffer{ 0 };
+	unsigned int m_indexBuffer{ 0 };
+	OffsetAllocator m_vertices{};
+	OffsetAllocator m_indices{};
+};
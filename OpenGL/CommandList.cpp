@@ -0,0 +1,261 @@
+#include "CommandList.h"
+#include "GLObjects.h"
+#include "Profiler.h"
+#include "RenderState.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+static std::size_t alignUp(std::size_t size)
+{
+	return (size + 7) & ~(std::size_t)7;
+}
+
+// COMMAND ARENA
+// -------------
+CommandArena::CommandArena(std::size_t blockSize)
+	: m_blockSize{ alignUp(blockSize) }
+{
+}
+void* CommandArena::allocate(std::size_t size)
+{
+	size = alignUp(size);
+	// Blocks too small for this allocation stay empty, readers skip them
+	while (m_current < m_blocks.size() && m_blocks[m_current].capacity - m_blocks[m_current].used < size)
+		++m_current;
+	if (m_current == m_blocks.size())
+	{
+		std::size_t capacity{ std::max(size, m_blockSize) };
+		m_blocks.push_back(Block{ std::unique_ptr<unsigned char[]>{ new unsigned char[capacity] }, capacity, 0 });
+	}
+	Block& block{ m_blocks[m_current] };
+	void* memory{ block.data.get() + block.used };
+	block.used += size;
+	return memory;
+}
+void CommandArena::reset()
+{
+	for (Block& block : m_blocks)
+		block.used = 0;
+	m_current = 0;
+}
+std::size_t CommandArena::bytesUsed() const
+{
+	std::size_t used{ 0 };
+	for (const Block& block : m_blocks)
+		used += block.used;
+	return used;
+}
+std::size_t CommandArena::bytesReserved() const
+{
+	std::size_t reserved{ 0 };
+	for (const Block& block : m_blocks)
+		reserved += block.capacity;
+	return reserved;
+}
+// COMMANDS
+// --------
+// Each command is a header followed by its payload, padded to 8 bytes.
+enum CommandType : std::uint16_t
+{
+	CommandUseProgram,
+	CommandBindVertexArray,
+	CommandBindTexture,
+	CommandSetBlend,
+	CommandBlendFunc,
+	CommandSetDepthTest,
+	CommandDepthFunc,
+	CommandDepthMask,
+	CommandSetCullFace,
+	CommandUniform4,
+	CommandUniformMatrix4,
+	CommandDraw,
+	CommandUpdateBuffer
+};
+
+struct CommandHeader
+{
+	std::uint16_t type;
+	std::uint16_t reserved;
+	std::uint32_t size; // header and payload, padding included
+};
+
+struct TextureCommand
+{
+	unsigned int unit;
+	GLenum target;
+	unsigned int texture;
+};
+
+struct UniformCommand
+{
+	int location;
+	float values[16];
+};
+
+struct BufferCommand
+{
+	Buffer* buffer;
+	GLintptr offset;
+	GLsizeiptr size; // followed by the data
+};
+
+void* CommandList::record(std::uint16_t type, std::size_t payloadSize)
+{
+	std::size_t size{ alignUp(sizeof(CommandHeader) + payloadSize) };
+	CommandHeader* header{ (CommandHeader*)m_arena.allocate(size) };
+	header->type = type;
+	header->reserved = 0;
+	header->size = (std::uint32_t)size;
+	++m_count;
+	return header + 1;
+}
+// RECORDING
+// ---------
+void CommandList::useProgram(unsigned int program)
+{
+	*(unsigned int*)record(CommandUseProgram, sizeof(unsigned int)) = program;
+}
+void CommandList::bindVertexArray(unsigned int vertexArray)
+{
+	*(unsigned int*)record(CommandBindVertexArray, sizeof(unsigned int)) = vertexArray;
+}
+void CommandList::bindTexture(unsigned int unit, GLenum target, unsigned int texture)
+{
+	*(TextureCommand*)record(CommandBindTexture, sizeof(TextureCommand)) = TextureCommand{ unit, target, texture };
+}
+void CommandList::setBlend(bool enabled)
+{
+	*(unsigned int*)record(CommandSetBlend, sizeof(unsigned int)) = enabled;
+}
+void CommandList::blendFunc(GLenum source, GLenum destination)
+{
+	GLenum* factors{ (GLenum*)record(CommandBlendFunc, 2 * sizeof(GLenum)) };
+	factors[0] = source;
+	factors[1] = destination;
+}
+void CommandList::setDepthTest(bool enabled)
+{
+	*(unsigned int*)record(CommandSetDepthTest, sizeof(unsigned int)) = enabled;
+}
+void CommandList::depthFunc(GLenum function)
+{
+	*(GLenum*)record(CommandDepthFunc, sizeof(GLenum)) = function;
+}
+void CommandList::depthMask(bool enabled)
+{
+	*(unsigned int*)record(CommandDepthMask, sizeof(unsigned int)) = enabled;
+}
+void CommandList::setCullFace(bool enabled)
+{
+	*(unsigned int*)record(CommandSetCullFace, sizeof(unsigned int)) = enabled;
+}
+void CommandList::setUniform(int location, float x, float y, float z, float w)
+{
+	// Only the used part of the values is stored
+	UniformCommand* command{ (UniformCommand*)record(CommandUniform4, offsetof(UniformCommand, values) + 4 * sizeof(float)) };
+	command->location = location;
+	command->values[0] = x;
+	command->values[1] = y;
+	command->values[2] = z;
+	command->values[3] = w;
+}
+void CommandList::setUniformMatrix4(int location, const float* matrix)
+{
+	UniformCommand* command{ (UniformCommand*)record(CommandUniformMatrix4, sizeof(UniformCommand)) };
+	command->location = location;
+	std::memcpy(command->values, matrix, sizeof(command->values));
+}
+void CommandList::draw(const DrawItem& item)
+{
+	*(DrawItem*)record(CommandDraw, sizeof(DrawItem)) = item;
+}
+void CommandList::updateBuffer(Buffer& buffer, GLintptr offset, GLsizeiptr size, const void* data)
+{
+	BufferCommand* command{ (BufferCommand*)record(CommandUpdateBuffer, sizeof(BufferCommand) + size) };
+	*command = BufferCommand{ &buffer, offset, size };
+	std::memcpy(command + 1, data, size);
+}
+void CommandList::reset()
+{
+	m_arena.reset();
+	m_count = 0;
+}
+// REPLAY
+// ------
+void CommandList::execute(RenderStateCache& state) const
+{
+	PROFILE_SCOPE("CommandList::execute");
+	for (int block{ 0 }; block < m_arena.blockCount(); ++block)
+	{
+		const unsigned char* command{ m_arena.blockData(block) };
+		const unsigned char* end{ command + m_arena.blockUsed(block) };
+		while (command < end)
+		{
+			const CommandHeader& header{ *(const CommandHeader*)command };
+			const void* payload{ command + sizeof(CommandHeader) };
+			switch (header.type)
+			{
+			case CommandUseProgram:
+				state.useProgram(*(const unsigned int*)payload);
+				break;
+			case CommandBindVertexArray:
+				state.bindVertexArray(*(const unsigned int*)payload);
+				break;
+			case CommandBindTexture:
+			{
+				const TextureCommand& texture{ *(const TextureCommand*)payload };
+				state.bindTexture(texture.unit, texture.target, texture.texture);
+				break;
+			}
+			case CommandSetBlend:
+				state.setBlend(*(const unsigned int*)payload != 0);
+				break;
+			case CommandBlendFunc:
+				state.blendFunc(((const GLenum*)payload)[0], ((const GLenum*)payload)[1]);
+				break;
+			case CommandSetDepthTest:
+				state.setDepthTest(*(const unsigned int*)payload != 0);
+				break;
+			case CommandDepthFunc:
+				state.depthFunc(*(const GLenum*)payload);
+				break;
+			case CommandDepthMask:
+				state.depthMask(*(const unsigned int*)payload != 0);
+				break;
+			case CommandSetCullFace:
+				state.setCullFace(*(const unsigned int*)payload != 0);
+				break;
+			case CommandUniform4:
+			{
+				const UniformCommand& uniform{ *(const UniformCommand*)payload };
+				glUniform4fv(uniform.location, 1, uniform.values);
+				break;
+			}
+			case CommandUniformMatrix4:
+			{
+				const UniformCommand& uniform{ *(const UniformCommand*)payload };
+				glUniformMatrix4fv(uniform.location, 1, GL_FALSE, uniform.values);
+				break;
+			}
+			case CommandDraw:
+			{
+				const DrawItem& item{ *(const DrawItem*)payload };
+				state.useProgram(item.program);
+				state.bindVertexArray(item.vertexArray);
+				// Unlike RenderQueue, texture 0 unbinds: what a list draws must not depend on the list before it
+				state.bindTexture(0, GL_TEXTURE_2D, item.texture);
+				drawItem(item, item.count);
+				break;
+			}
+			case CommandUpdateBuffer:
+			{
+				const BufferCommand& update{ *(const BufferCommand*)payload };
+				update.buffer->update(update.offset, update.size, &update + 1);
+				break;
+			}
+			}
+			command += header.size;
+		}
+	}
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include "RenderQueue.h"
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class Buffer;
+class RenderStateCache;
+
+// COMMAND ARENA
+// -------------
+// Linear allocator over a list of blocks. reset() rewinds without freeing, so
+// after the first frames recording allocates nothing. Allocations are 8 byte
+// aligned; one bigger than the block size gets a block of its own.
+class CommandArena
+{
+public:
+	explicit CommandArena(std::size_t blockSize = 64 * 1024);
+
+	void* allocate(std::size_t size);
+	void reset();
+
+	int blockCount() const { return (int)m_blocks.size(); }
+	const unsigned char* blockData(int block) const { return m_blocks[block].data.get(); }
+	std::size_t blockUsed(int block) const { return m_blocks[block].used; }
+	std::size_t bytesUsed() const;
+	std::size_t bytesReserved() const;
+
+private:
+	struct Block
+	{
+		std::unique_ptr<unsigned char[]> data;
+		std::size_t capacity;
+		std::size_t used;
+	};
+
+	std::vector<Block> m_blocks{};
+	std::size_t m_current{ 0 };
+	std::size_t m_blockSize;
+};
+
+// COMMAND LIST
+// ------------
+// Render commands recorded without touching GL, so any thread can build one,
+// and replayed by execute() on the thread that owns the context. Commands are
+// packed back to back into the list's own CommandArena; give each recording
+// thread or job its own list and execute the lists in the order the frame
+// needs. State goes through the RenderStateCache on replay, so redundant
+// state between (and inside) lists is still elided.
+//
+//   // workers, one list per chunk of the scene
+//   lists[chunk].reset();
+//   lists[chunk].setUniform(tint, r, g, b, 1.0f);
+//   lists[chunk].draw(item);
+//   // GL thread
+//   for (const CommandList& list : lists)
+//       list.execute(state);
+//
+// Ids and Buffer pointers are only dereferenced on replay and must stay valid
+// until then. Data passed to updateBuffer() is copied at record time. draw()
+// binds the item's program, vertex array and texture, an item without a
+// texture unbinds unit 0 rather than keeping whatever a previous list bound.
+class CommandList
+{
+public:
+	explicit CommandList(std::size_t blockSize = 64 * 1024) : m_arena{ blockSize } {}
+
+	void useProgram(unsigned int program);
+	void bindVertexArray(unsigned int vertexArray);
+	void bindTexture(unsigned int unit, GLenum target, unsigned int texture);
+	void setBlend(bool enabled);
+	void blendFunc(GLenum source, GLenum destination);
+	void setDepthTest(bool enabled);
+	void depthFunc(GLenum function);
+	void depthMask(bool enabled);
+	void setCullFace(bool enabled);
+
+	// Uniforms of the program bound when the command replays, by useProgram()
+	// or by the last draw
+	void setUniform(int location, float x, float y, float z, float w);
+	void setUniformMatrix4(int location, const float* matrix); // column major
+
+	// Binds the item's program, vertex array and texture, then draws it
+	void draw(const DrawItem& item);
+	void updateBuffer(Buffer& buffer, GLintptr offset, GLsizeiptr size, const void* data);
+
+	void execute(RenderStateCache& state) const;
+	void reset();
+
+	int size() const { return m_count; }
+	std::size_t bytes() const { return m_arena.bytesUsed(); }
+
+private:
+	void* record(std::uint16_t type, std::size_t payloadSize);
+
+	CommandArena m_arena;
+	int m_count{ 0 };
+};
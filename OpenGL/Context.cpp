@@ -0,0 +1,366 @@
+#include "Context.h"
+#include "GLTrace.h"
+#ifndef ENGINE_NO_GLFW
+#include <GLFW/glfw3.h>
+#endif
+#ifdef ENGINE_EGL
+#define EGL_NO_X11
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+#include <iostream>
+#include <mutex>
+
+// FRAMEBUFFER_SIZE_CALLBACK
+// -------------------------
+#ifndef ENGINE_NO_GLFW
+static void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+	glViewport(0, 0, width, height);
+}
+#endif
+
+// SHARED PLATFORM STATE
+// ---------------------
+// glfwInit/glfwTerminate and eglInitialize/eglTerminate are process wide
+// (eglGetPlatformDisplay hands every caller the same display), so they are
+// reference counted across all live contexts.
+static std::mutex platformMutex{};
+#ifndef ENGINE_NO_GLFW
+static int glfwUsers{ 0 };
+#endif
+#ifdef ENGINE_EGL
+static int eglUsers{ 0 };
+#endif
+
+Context::~Context()
+{
+	destroy();
+}
+// CREATE
+// ------
+bool Context::create(const ContextOptions& options)
+{
+	m_options = options;
+	m_width = options.width;
+	m_height = options.height;
+	m_frameCount = 0;
+	if (m_options.backend == ContextBackend::Headless && m_options.frameLimit <= 0)
+		m_options.frameLimit = DEFAULT_HEADLESS_FRAMES;
+
+	bool created{ m_options.backend == ContextBackend::Headless ? createHeadless(nullptr) : createWindow(nullptr) };
+	if (!created)
+	{
+		destroy();
+		return false;
+	}
+	// LOAD OPENGL FUNCTION POINTERS
+	// -----------------------------
+	if (!loadFunctions())
+	{
+		std::cout << "Failed to load OpenGL function pointers" << std::endl;
+		destroy();
+		return false;
+	}
+	// HEADLESS CONTEXTS HAVE NO DEFAULT FRAMEBUFFER, SO RENDER INTO AN FBO INSTEAD
+	// ----------------------------------------------------------------------------
+	if (isHeadless() && !createRenderTarget())
+	{
+		destroy();
+		return false;
+	}
+	return true;
+}
+bool Context::createShared(Context& main)
+{
+	if (!GLTrace::addSharedContext())
+		return false;
+	m_shared = true;
+	m_options = main.m_options;
+	m_width = 1;
+	m_height = 1;
+	m_frameCount = 0;
+	bool created{ isHeadless() ? createHeadless(&main) : createWindow(&main) };
+	// The global function pointers are already loaded and valid for every
+	// context of the driver; reloading them would race with main's thread
+	m_loader = main.m_loader;
+	if (created && m_options.contextDispatch && !loadFunctions())
+	{
+		std::cout << "Failed to load OpenGL function pointers" << std::endl;
+		created = false;
+	}
+	if (!created)
+		destroy();
+	main.makeCurrent();
+	return created;
+}
+bool Context::loadFunctions()
+{
+	if (!m_options.contextDispatch)
+		return m_options.lazyLoading ? gladLoadGLLoaderLazy(m_loader) : gladLoadGLLoader(m_loader);
+	// Per-context tables are always resolved eagerly, the global pointers become forwarding stubs
+	if (!gladLoadGLContext(&m_dispatch, m_loader))
+		return false;
+	m_dispatchLoaded = true;
+	gladMakeContextCurrent(&m_dispatch);
+	gladUseContextDispatch();
+	return true;
+}
+// WINDOW BACKEND (GLFW)
+// ---------------------
+bool Context::createWindow(const Context* share)
+{
+#ifndef ENGINE_NO_GLFW
+	{
+		std::lock_guard<std::mutex> lock{ platformMutex };
+		if (glfwUsers == 0 && !glfwInit())
+		{
+			std::cout << "GLFW failed to initialize" << std::endl;
+			return false;
+		}
+		++glfwUsers;
+		m_glfwInitialized = true;
+	}
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, m_options.debugContext ? GLFW_TRUE : GLFW_FALSE);
+	glfwWindowHint(GLFW_VISIBLE, share != nullptr ? GLFW_FALSE : GLFW_TRUE);
+	m_window = glfwCreateWindow(m_width, m_height, m_options.title, NULL, share != nullptr ? share->m_window : NULL);
+	if (m_window == NULL)
+	{
+		std::cout << "Window failed to create" << std::endl;
+		return false;
+	}
+	glfwMakeContextCurrent(m_window);
+	if (share == nullptr)
+		glfwSetFramebufferSizeCallback(m_window, framebuffer_size_callback);
+	m_loader = (GLADloadproc)glfwGetProcAddress;
+	return true;
+#else
+	(void)share;
+	std::cout << "Window support was not compiled in, run with --headless" << std::endl;
+	return false;
+#endif
+}
+// HEADLESS BACKEND (EGL SURFACELESS)
+// ----------------------------------
+bool Context::createHeadless(const Context* share)
+{
+#ifdef ENGINE_EGL
+	// Prefer the Mesa surfaceless platform, it needs neither a display server nor a GPU
+	EGLDisplay display{ EGL_NO_DISPLAY };
+	PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay{ (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT") };
+	if (getPlatformDisplay != NULL)
+		display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+	if (display == EGL_NO_DISPLAY)
+		display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	{
+		std::lock_guard<std::mutex> lock{ platformMutex };
+		if (display == EGL_NO_DISPLAY || (eglUsers == 0 && !eglInitialize(display, NULL, NULL)))
+		{
+			std::cout << "EGL failed to initialize" << std::endl;
+			return false;
+		}
+		++eglUsers;
+		m_eglDisplay = display;
+	}
+	if (!eglBindAPI(EGL_OPENGL_API))
+	{
+		std::cout << "EGL does not support desktop OpenGL" << std::endl;
+		return false;
+	}
+	// Surfaceless contexts don't need a config, but use one when the driver offers it
+	EGLint configAttributes[]
+	{
+		EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_NONE
+	};
+	EGLConfig config{ EGL_NO_CONFIG_KHR };
+	EGLint configCount{ 0 };
+	if (!eglChooseConfig(display, configAttributes, &config, 1, &configCount) || configCount == 0)
+		config = EGL_NO_CONFIG_KHR;
+	EGLint contextAttributes[]
+	{
+		EGL_CONTEXT_MAJOR_VERSION, 3,
+		EGL_CONTEXT_MINOR_VERSION, 3,
+		EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+		EGL_CONTEXT_OPENGL_DEBUG, m_options.debugContext ? EGL_TRUE : EGL_FALSE,
+		EGL_NONE
+	};
+	EGLContext shareContext{ share != nullptr ? (EGLContext)share->m_eglContext : EGL_NO_CONTEXT };
+	EGLContext context{ eglCreateContext(display, config, shareContext, contextAttributes) };
+	if (context == EGL_NO_CONTEXT && m_options.debugContext)
+	{
+		// EGL_CONTEXT_OPENGL_DEBUG is EGL 1.5, older drivers reject the attribute
+		std::cout << "Debug context unavailable, creating a regular one" << std::endl;
+		contextAttributes[6] = EGL_NONE;
+		context = eglCreateContext(display, config, shareContext, contextAttributes);
+	}
+	if (context == EGL_NO_CONTEXT)
+	{
+		std::cout << "Headless context failed to create" << std::endl;
+		return false;
+	}
+	m_eglContext = context;
+	if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+	{
+		std::cout << "Headless context failed to make current" << std::endl;
+		return false;
+	}
+	m_loader = (GLADloadproc)eglGetProcAddress;
+	return true;
+#else
+	(void)share;
+	std::cout << "Headless support was not compiled in" << std::endl;
+	return false;
+#endif
+}
+// OFFSCREEN RENDER TARGET
+// -----------------------
+bool Context::createRenderTarget()
+{
+	glGenRenderbuffers(1, &m_colorBuffer);
+	glBindRenderbuffer(GL_RENDERBUFFER, m_colorBuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, m_width, m_height);
+	glGenRenderbuffers(1, &m_depthBuffer);
+	glBindRenderbuffer(GL_RENDERBUFFER, m_depthBuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, m_width, m_height);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	glGenFramebuffers(1, &m_framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_colorBuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_depthBuffer);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+	{
+		std::cout << "Offscreen framebuffer is incomplete" << std::endl;
+		return false;
+	}
+	// The framebuffer stays bound for the lifetime of the context, it stands in for the window
+	glViewport(0, 0, m_width, m_height);
+	return true;
+}
+// DESTROY
+// -------
+void Context::destroy()
+{
+	if (m_framebuffer != 0)
+	{
+		glDeleteFramebuffers(1, &m_framebuffer);
+		glDeleteRenderbuffers(1, &m_colorBuffer);
+		glDeleteRenderbuffers(1, &m_depthBuffer);
+		m_framebuffer = m_colorBuffer = m_depthBuffer = 0;
+	}
+	if (m_dispatchLoaded)
+	{
+		gladFreeGLContext(&m_dispatch);
+		m_dispatchLoaded = false;
+	}
+	if (m_shared)
+	{
+		GLTrace::removeSharedContext();
+		m_shared = false;
+	}
+#ifdef ENGINE_EGL
+	if (m_eglDisplay != NULL)
+	{
+		if (m_eglContext != NULL)
+		{
+			if (eglGetCurrentContext() == m_eglContext)
+				eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+			eglDestroyContext(m_eglDisplay, m_eglContext);
+		}
+		std::lock_guard<std::mutex> lock{ platformMutex };
+		if (--eglUsers == 0)
+			eglTerminate(m_eglDisplay);
+		m_eglContext = NULL;
+		m_eglDisplay = NULL;
+	}
+#endif
+#ifndef ENGINE_NO_GLFW
+	if (m_window != NULL)
+	{
+		glfwDestroyWindow(m_window);
+		m_window = NULL;
+	}
+	if (m_glfwInitialized)
+	{
+		std::lock_guard<std::mutex> lock{ platformMutex };
+		if (--glfwUsers == 0)
+			glfwTerminate();
+		m_glfwInitialized = false;
+	}
+#endif
+	m_loader = NULL;
+}
+// RENDER LOOP HELPERS
+// -------------------
+bool Context::shouldClose() const
+{
+	if (m_options.frameLimit > 0 && m_frameCount >= m_options.frameLimit)
+		return true;
+#ifndef ENGINE_NO_GLFW
+	if (m_window != NULL)
+		return glfwWindowShouldClose(m_window);
+#endif
+	return false;
+}
+void Context::processInput()
+{
+#ifndef ENGINE_NO_GLFW
+	if (m_window != NULL && glfwGetKey(m_window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+		glfwSetWindowShouldClose(m_window, true);
+#endif
+}
+void Context::swapBuffers()
+{
+	++m_frameCount;
+	GLTrace::markFrame();
+#ifndef ENGINE_NO_GLFW
+	if (m_window != NULL)
+	{
+		glfwSwapBuffers(m_window);
+		return;
+	}
+#endif
+	// Nothing to present offscreen, just hand the frame to the driver like a swap would
+	glFlush();
+}
+void Context::pollEvents()
+{
+#ifndef ENGINE_NO_GLFW
+	if (m_window != NULL)
+		glfwPollEvents();
+#endif
+}
+// MAKE CURRENT
+// ------------
+bool Context::makeCurrent()
+{
+#ifdef ENGINE_EGL
+	if (m_eglContext != NULL && !eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, m_eglContext))
+		return false;
+#endif
+#ifndef ENGINE_NO_GLFW
+	if (m_window != NULL)
+		glfwMakeContextCurrent(m_window);
+#endif
+	if (m_dispatchLoaded)
+		gladMakeContextCurrent(&m_dispatch);
+	return true;
+}
+void Context::releaseCurrent()
+{
+#ifdef ENGINE_EGL
+	if (m_eglContext != NULL)
+		eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+#endif
+#ifndef ENGINE_NO_GLFW
+	if (m_window != NULL)
+		glfwMakeContextCurrent(NULL);
+#endif
+	if (m_dispatchLoaded && gladGetCurrentContext() == &m_dispatch)
+		gladMakeContextCurrent(NULL);
+}
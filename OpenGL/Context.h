@@ -0,0 +1,101 @@
+#pragma once
+#include <glad/glad.h>
+
+// CONTEXT BACKENDS
+// ----------------
+// Window creates a visible GLFW window and renders to its default framebuffer.
+// Headless creates a surfaceless EGL context (Mesa llvmpipe works fine) and
+// renders into an offscreen framebuffer object of the same size, so the render
+// loop runs unchanged on machines without a display or GPU.
+enum class ContextBackend
+{
+	Window,
+	Headless
+};
+
+struct ContextOptions
+{
+	ContextBackend backend{ ContextBackend::Window };
+	int width{ 800 };
+	int height{ 800 };
+	const char* title{ "This is going to be an epic demo :D" };
+	int frameLimit{ 0 }; // 0 runs until the window is closed, headless falls back to DEFAULT_HEADLESS_FRAMES
+	bool lazyLoading{ false }; // resolve GL entry points on first call instead of all of them at startup
+	bool contextDispatch{ false }; // load into a per-context dispatch table, needed when one process drives several contexts
+	bool debugContext{ false }; // ask for a debug context so KHR_debug output is complete (see DebugOutput)
+};
+
+constexpr int DEFAULT_HEADLESS_FRAMES{ 600 };
+
+struct GLFWwindow;
+
+// CONTEXT
+// -------
+// Owns the GL context, the surface it renders to and the loaded function
+// pointers. Everything after create() only needs a current context, so code
+// in main() never has to know which backend it is running on.
+//
+// With contextDispatch every Context gets its own GladGLContext table and
+// makeCurrent() routes the calling thread's GL calls through it, so N
+// contexts can render on N threads at once. A context is current on the
+// thread that created it; call makeCurrent() after handing it to another.
+//
+// createShared() makes a second context that shares textures, buffers,
+// programs and sync objects (not vertex arrays or framebuffers) with an
+// existing one, for uploading from another thread. It has no surface of its
+// own (a hidden window or a surfaceless EGL context) and leaves the main
+// context current on the calling thread. It fails while GLTrace is recording.
+class Context
+{
+public:
+	Context() = default;
+	~Context();
+	Context(const Context&) = delete;
+	Context& operator=(const Context&) = delete;
+
+	bool create(const ContextOptions& options);
+	bool createShared(Context& main); // call on main's thread
+	void destroy();
+
+	bool shouldClose() const;
+	void processInput();
+	void swapBuffers();
+	void pollEvents();
+	bool makeCurrent();
+	void releaseCurrent();
+
+	ContextBackend backend() const { return m_options.backend; }
+	bool isHeadless() const { return m_options.backend == ContextBackend::Headless; }
+	int width() const { return m_width; }
+	int height() const { return m_height; }
+	long long frameCount() const { return m_frameCount; }
+	GLADloadproc loader() const { return m_loader; }
+	GladGLContext* dispatch() { return m_options.contextDispatch ? &m_dispatch : nullptr; }
+
+private:
+	bool createWindow(const Context* share);
+	bool createHeadless(const Context* share);
+	bool createRenderTarget();
+	bool loadFunctions();
+
+	ContextOptions m_options{};
+	GLADloadproc m_loader{ nullptr };
+	int m_width{ 0 };
+	int m_height{ 0 };
+	long long m_frameCount{ 0 };
+	GladGLContext m_dispatch{};
+	bool m_dispatchLoaded{ false };
+	bool m_shared{ false };
+
+	// WINDOW BACKEND
+	bool m_glfwInitialized{ false };
+	GLFWwindow* m_window{ nullptr };
+
+	// HEADLESS BACKEND
+	// EGLDisplay and EGLContext are opaque pointers, kept as void* so callers don't need EGL headers
+	void* m_eglDisplay{ nullptr };
+	void* m_eglContext{ nullptr };
+	unsigned int m_framebuffer{ 0 };
+	unsigned int m_colorBuffer{ 0 };
+	unsigned int m_depthBuffer{ 0 };
+};
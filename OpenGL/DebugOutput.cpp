@@ -0,0 +1,204 @@
+#include "DebugOutput.h"
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <vector>
+
+// NAMES
+// -----
+static const char* sourceName(GLenum source)
+{
+	switch (source)
+	{
+	case GL_DEBUG_SOURCE_API: return "api";
+	case GL_DEBUG_SOURCE_WINDOW_SYSTEM: return "window system";
+	case GL_DEBUG_SOURCE_SHADER_COMPILER: return "shader compiler";
+	case GL_DEBUG_SOURCE_THIRD_PARTY: return "third party";
+	case GL_DEBUG_SOURCE_APPLICATION: return "application";
+	default: return "other";
+	}
+}
+static const char* typeName(GLenum type)
+{
+	switch (type)
+	{
+	case GL_DEBUG_TYPE_ERROR: return "error";
+	case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated";
+	case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "undefined behavior";
+	case GL_DEBUG_TYPE_PORTABILITY: return "portability";
+	case GL_DEBUG_TYPE_PERFORMANCE: return "performance";
+	case GL_DEBUG_TYPE_MARKER: return "marker";
+	default: return "other";
+	}
+}
+static const char* severityName(GLenum severity)
+{
+	switch (severity)
+	{
+	case GL_DEBUG_SEVERITY_HIGH: return "high";
+	case GL_DEBUG_SEVERITY_MEDIUM: return "medium";
+	case GL_DEBUG_SEVERITY_LOW: return "low";
+	default: return "notification";
+	}
+}
+// Words drivers use when they fall off the fast path without calling it a performance message
+static bool mentionsSlowPath(const std::string& text)
+{
+	static const char* patterns[]{ "recompil", "migrat", "stall", "fallback", "software", "emulat", "copying" };
+	std::string lower{ text };
+	std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+	for (const char* pattern : patterns)
+	{
+		if (lower.find(pattern) != std::string::npos)
+			return true;
+	}
+	return false;
+}
+static std::uint64_t hashText(const GLchar* text, GLsizei length)
+{
+	// FNV-1a
+	std::uint64_t hash{ 14695981039346656037ull };
+	for (GLsizei i{ 0 }; i < length; ++i)
+	{
+		hash ^= (unsigned char)text[i];
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+// CREATE
+// ------
+DebugOutput::~DebugOutput()
+{
+	destroy();
+}
+bool DebugOutput::create(const DebugOutputOptions& options)
+{
+	destroy();
+	GLint major{ 0 };
+	GLint minor{ 0 };
+	glGetIntegerv(GL_MAJOR_VERSION, &major);
+	glGetIntegerv(GL_MINOR_VERSION, &minor);
+	// KHR_debug on desktop GL uses the unsuffixed entry points, glad only loads them for 4.3 contexts
+	bool supported{ (major * 10 + minor >= 43 || gladHasExtension("GL_KHR_debug")) && glDebugMessageCallback != NULL && glDebugMessageControl != NULL };
+	if (!supported)
+	{
+		std::cout << "KHR_debug output is not supported by this context" << std::endl;
+		return false;
+	}
+	GLint flags{ 0 };
+	glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+	if ((flags & GL_CONTEXT_FLAG_DEBUG_BIT) == 0)
+		std::cout << "Not a debug context, the driver may leave out debug messages" << std::endl;
+
+	m_options = options;
+	m_options.printLimit = std::max(m_options.printLimit, 0);
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		m_messages.clear();
+		m_stats = DebugOutputStats{};
+	}
+	glEnable(GL_DEBUG_OUTPUT);
+	if (m_options.synchronous)
+		glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	else
+		glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	glDebugMessageCallback(callback, this);
+
+	// FILTERING
+	// ---------
+	// Enable everything, then switch off what is not wanted. Later calls win.
+	glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_TRUE);
+	const GLenum severities[]{ GL_DEBUG_SEVERITY_NOTIFICATION, GL_DEBUG_SEVERITY_LOW, GL_DEBUG_SEVERITY_MEDIUM };
+	for (int i{ 0 }; i < (int)m_options.minimumSeverity && i < 3; ++i)
+		glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, severities[i], 0, NULL, GL_FALSE);
+	if (m_options.performanceWarnings)
+	{
+		glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_PERFORMANCE, GL_DEBUG_SEVERITY_LOW, 0, NULL, GL_TRUE);
+		glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_PERFORMANCE, GL_DEBUG_SEVERITY_MEDIUM, 0, NULL, GL_TRUE);
+	}
+	if (!m_options.shaderCompiler)
+		glDebugMessageControl(GL_DEBUG_SOURCE_SHADER_COMPILER, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_FALSE);
+	if (!m_options.application)
+	{
+		glDebugMessageControl(GL_DEBUG_SOURCE_APPLICATION, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_FALSE);
+		glDebugMessageControl(GL_DEBUG_SOURCE_THIRD_PARTY, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_FALSE);
+	}
+	// Push/pop group markers only add noise to a log
+	glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_PUSH_GROUP, GL_DONT_CARE, 0, NULL, GL_FALSE);
+	glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_POP_GROUP, GL_DONT_CARE, 0, NULL, GL_FALSE);
+	m_installed = true;
+	return true;
+}
+void DebugOutput::destroy()
+{
+	if (!m_installed)
+		return;
+	glDebugMessageCallback(NULL, NULL);
+	glDisable(GL_DEBUG_OUTPUT);
+	m_installed = false;
+}
+// MESSAGES
+// --------
+void APIENTRY DebugOutput::callback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* userParam)
+{
+	((DebugOutput*)userParam)->receive(source, type, id, severity, length, message);
+}
+void DebugOutput::receive(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message)
+{
+	if (length < 0)
+		length = (GLsizei)std::char_traits<GLchar>::length(message);
+	// Some drivers give every message id 0, so the text is part of the identity
+	std::uint64_t key{ hashText(message, length) ^ ((std::uint64_t)source << 48) ^ ((std::uint64_t)type << 32) ^ id };
+
+	std::lock_guard<std::mutex> lock{ m_mutex };
+	++m_stats.messages;
+	auto found{ m_messages.find(key) };
+	if (found == m_messages.end())
+	{
+		std::string text{ message, (std::size_t)length };
+		while (!text.empty() && (text.back() == '\n' || text.back() == '\r'))
+			text.pop_back();
+		bool performance{ type == GL_DEBUG_TYPE_PERFORMANCE || (type != GL_DEBUG_TYPE_ERROR && mentionsSlowPath(text)) };
+		found = m_messages.emplace(key, Message{ source, type, id, severity, performance, 0, std::move(text) }).first;
+		++m_stats.distinct;
+	}
+	Message& entry{ found->second };
+	++entry.count;
+	if (type == GL_DEBUG_TYPE_ERROR)
+		++m_stats.errors;
+	if (entry.performance)
+		++m_stats.performanceWarnings;
+	if (entry.count > m_options.printLimit)
+	{
+		++m_stats.suppressed;
+		return;
+	}
+	std::cout << "GL " << (entry.performance ? "PERFORMANCE " : "") << typeName(type) << " [" << sourceName(source) << ", "
+		<< severityName(severity) << ", id " << id << "]: " << entry.text;
+	if (entry.count == m_options.printLimit)
+		std::cout << " (further repeats only counted)";
+	std::cout << std::endl;
+}
+// STATISTICS
+// ----------
+DebugOutputStats DebugOutput::stats() const
+{
+	std::lock_guard<std::mutex> lock{ m_mutex };
+	return m_stats;
+}
+void DebugOutput::printStats() const
+{
+	std::lock_guard<std::mutex> lock{ m_mutex };
+	std::cout << "GL debug output: " << m_stats.messages << " messages (" << m_stats.distinct << " distinct), " << m_stats.errors
+		<< " errors, " << m_stats.performanceWarnings << " performance warnings, " << m_stats.suppressed << " repeats suppressed" << std::endl;
+	// Most frequent first
+	std::vector<const Message*> sorted{};
+	for (const auto& entry : m_messages)
+		sorted.push_back(&entry.second);
+	std::sort(sorted.begin(), sorted.end(), [](const Message* a, const Message* b) { return a->count > b->count; });
+	for (const Message* message : sorted)
+	{
+		std::cout << "  " << message->count << "x " << (message->performance ? "PERFORMANCE " : "") << typeName(message->type)
+			<< " [" << sourceName(message->source) << ", " << severityName(message->severity) << "]: " << message->text << std::endl;
+	}
+}
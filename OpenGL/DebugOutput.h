@@ -0,0 +1,81 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+enum class DebugSeverity
+{
+	Notification,
+	Low,
+	Medium,
+	High
+};
+
+struct DebugOutputOptions
+{
+	DebugSeverity minimumSeverity{ DebugSeverity::Low };
+	bool performanceWarnings{ true };   // always report performance messages that reach the low severity
+	bool shaderCompiler{ true };        // GL_DEBUG_SOURCE_SHADER_COMPILER
+	bool application{ false };          // messages the engine or tools insert themselves
+	bool synchronous{ true };           // report inside the offending call, so a breakpoint there has the culprit on the stack
+	int printLimit{ 3 };                // times each distinct message is printed, later repeats are only counted
+};
+
+struct DebugOutputStats
+{
+	long long messages{ 0 };
+	long long errors{ 0 };
+	long long performanceWarnings{ 0 };
+	long long suppressed{ 0 }; // repeats past printLimit
+	int distinct{ 0 };
+};
+
+// DEBUG OUTPUT
+// ------------
+// Routes KHR_debug messages (GL 4.3 or GL_KHR_debug) into the log. Messages
+// below the severity threshold or from disabled sources are filtered by the
+// driver through glDebugMessageControl, so they cost nothing. What remains is
+// deduplicated per source/type/id/text: each distinct message is printed
+// printLimit times and counted after that, printStats() lists the counts.
+// Performance messages, and messages of any type that mention the usual slow
+// paths (buffer migration, shader recompiles, stalls, CPU fallbacks), are
+// tagged PERFORMANCE so hidden slow paths stand out in the log.
+// Drivers only promise complete output in debug contexts, see
+// ContextOptions::debugContext. The object must stay alive while installed.
+class DebugOutput
+{
+public:
+	DebugOutput() = default;
+	~DebugOutput();
+	DebugOutput(const DebugOutput&) = delete;
+	DebugOutput& operator=(const DebugOutput&) = delete;
+
+	bool create(const DebugOutputOptions& options = DebugOutputOptions{});
+	void destroy();
+
+	DebugOutputStats stats() const;
+	void printStats() const;
+
+private:
+	struct Message
+	{
+		GLenum source;
+		GLenum type;
+		GLuint id;
+		GLenum severity;
+		bool performance;
+		long long count;
+		std::string text;
+	};
+
+	static void APIENTRY callback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* userParam);
+	void receive(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message);
+
+	DebugOutputOptions m_options{};
+	bool m_installed{ false };
+	mutable std::mutex m_mutex{};
+	std::unordered_map<std::uint64_t, Message> m_messages{};
+	DebugOutputStats m_stats{};
+};
@@ -0,0 +1,154 @@
+#include "DrawCommandBuffer.h"
+#include "FrameStats.h"
+#include "RenderState.h"
+#include <algorithm>
+#include <iostream>
+
+DrawCommandBuffer::~DrawCommandBuffer()
+{
+	destroy();
+}
+bool DrawCommandBuffer::create(RenderStateCache& state, int capacity, GLADloadproc loader)
+{
+	// The cache would skip binding a recycled name it still records as bound
+	if (m_buffer != 0)
+	{
+		state.bindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+		state.bindBuffer(GL_COPY_READ_BUFFER, 0);
+	}
+	destroy();
+	int major{ 0 }, minor{ 0 };
+	glGetIntegerv(GL_MAJOR_VERSION, &major);
+	glGetIntegerv(GL_MINOR_VERSION, &minor);
+	int version{ major * 10 + minor };
+	// glad loads these with the core versions only, an extension alone leaves them NULL
+	m_multiDraw = (version >= 43 || gladHasExtension("GL_ARB_multi_draw_indirect")) && glMultiDrawElementsIndirect != NULL;
+	m_baseInstance = (version >= 42 || gladHasExtension("GL_ARB_base_instance")) && glDrawElementsInstancedBaseVertexBaseInstance != NULL;
+	m_drawCount = m_multiDraw && version >= 46 && glMultiDrawElementsIndirectCount != NULL;
+	m_multiDrawCountARB = NULL;
+	if (m_multiDraw && !m_drawCount && loader != nullptr && gladHasExtension("GL_ARB_indirect_parameters"))
+	{
+		m_multiDrawCountARB = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)loader("glMultiDrawElementsIndirectCountARB");
+		m_drawCount = m_multiDrawCountARB != NULL;
+	}
+	// Without baseInstance every command would draw with the first instance's data
+	if (!m_baseInstance)
+	{
+		std::cout << "Base instance is not supported, commands can not select their instance data" << std::endl;
+		return false;
+	}
+	if (!m_multiDraw)
+		std::cout << "Multi-draw indirect is not supported, drawing commands one at a time" << std::endl;
+
+	glGenBuffers(1, &m_buffer);
+	if (m_buffer == 0)
+	{
+		std::cout << "Draw command buffer failed to create" << std::endl;
+		return false;
+	}
+	// Storage up front, a GPU pass may write commands before anything is uploaded
+	m_capacity = capacity > 0 ? capacity : 1;
+	m_commands.reserve(m_capacity);
+	state.bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_buffer);
+	glBufferData(GL_DRAW_INDIRECT_BUFFER, m_capacity * sizeof(DrawElementsIndirectCommand), NULL, GL_STREAM_DRAW);
+	return true;
+}
+void DrawCommandBuffer::destroy()
+{
+	if (m_buffer != 0)
+		glDeleteBuffers(1, &m_buffer);
+	m_buffer = 0;
+	m_capacity = 0;
+	m_uploaded = 0;
+	m_commands.clear();
+}
+// BUILDING
+// --------
+void DrawCommandBuffer::add(GLuint count, GLuint firstIndex, GLint baseVertex, GLuint baseInstance, GLuint instanceCount)
+{
+	m_commands.push_back(DrawElementsIndirectCommand{ count, instanceCount, firstIndex, baseVertex, baseInstance });
+}
+void DrawCommandBuffer::upload(RenderStateCache& state)
+{
+	int count{ (int)m_commands.size() };
+	m_uploaded = count;
+	// The fallback draws straight from m_commands, the buffer still receives
+	// them so GPU passes see the same list on every path
+	state.bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_buffer);
+	if (count > m_capacity)
+		m_capacity = std::max(m_capacity * 2, count);
+	glBufferData(GL_DRAW_INDIRECT_BUFFER, m_capacity * sizeof(DrawElementsIndirectCommand), NULL, GL_STREAM_DRAW);
+	if (count > 0)
+		glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, count * sizeof(DrawElementsIndirectCommand), m_commands.data());
+	countUpload(count * sizeof(DrawElementsIndirectCommand));
+}
+// SUBMISSION
+// ----------
+void DrawCommandBuffer::submit(RenderStateCache& state, GLenum mode, GLenum indexType) const
+{
+	if (m_uploaded == 0)
+		return;
+	if (!m_multiDraw)
+	{
+		drawEach(mode, indexType, m_commands.data(), m_uploaded);
+		return;
+	}
+	state.bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_buffer);
+	countCommands(mode, m_uploaded);
+	glMultiDrawElementsIndirect(mode, indexType, (void*)0, m_uploaded, 0);
+}
+void DrawCommandBuffer::submitCount(RenderStateCache& state, GLenum mode, GLenum indexType, unsigned int parameterBuffer, GLintptr offset, int maxCount) const
+{
+	if (m_drawCount)
+	{
+		state.bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_buffer);
+		state.bindBuffer(GL_PARAMETER_BUFFER, parameterBuffer);
+		// The count lives on the GPU, only the call is known here
+		countDrawCall();
+		if (m_multiDrawCountARB != NULL)
+			m_multiDrawCountARB(mode, indexType, (void*)0, offset, maxCount, 0);
+		else
+			glMultiDrawElementsIndirectCount(mode, indexType, (void*)0, offset, maxCount, 0);
+		return;
+	}
+	GLuint count{ 0 };
+	state.bindBuffer(GL_COPY_READ_BUFFER, parameterBuffer);
+	glGetBufferSubData(GL_COPY_READ_BUFFER, offset, sizeof(count), &count);
+	if ((int)count > maxCount)
+		count = (GLuint)maxCount;
+	if ((int)count > m_capacity)
+		count = (GLuint)m_capacity;
+	if (count == 0)
+		return;
+	if (!m_multiDraw)
+	{
+		// The GPU wrote the commands as well, so read those back too instead
+		// of drawing whatever was last added on the CPU
+		std::vector<DrawElementsIndirectCommand> commands(count);
+		state.bindBuffer(GL_COPY_READ_BUFFER, m_buffer);
+		glGetBufferSubData(GL_COPY_READ_BUFFER, 0, count * sizeof(DrawElementsIndirectCommand), commands.data());
+		drawEach(mode, indexType, commands.data(), (int)count);
+		return;
+	}
+	state.bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_buffer);
+	// m_commands is not what the GPU wrote, only the call is known here
+	countDrawCall();
+	glMultiDrawElementsIndirect(mode, indexType, (void*)0, (GLsizei)count, 0);
+}
+void DrawCommandBuffer::countCommands(GLenum mode, int count) const
+{
+	countDrawCall();
+	for (int i{ 0 }; i < count && i < (int)m_commands.size(); ++i)
+		countPrimitives(mode, m_commands[i].count, m_commands[i].instanceCount);
+}
+void DrawCommandBuffer::drawEach(GLenum mode, GLenum indexType, const DrawElementsIndirectCommand* commands, int count) const
+{
+	std::size_t indexSize{ indexType == GL_UNSIGNED_SHORT ? 2u : indexType == GL_UNSIGNED_BYTE ? 1u : 4u };
+	for (int i{ 0 }; i < count; ++i)
+	{
+		const DrawElementsIndirectCommand& command{ commands[i] };
+		void* indices{ (void*)(command.firstIndex * indexSize) };
+		countDraw(mode, command.count, command.instanceCount);
+		glDrawElementsInstancedBaseVertexBaseInstance(mode, command.count, indexType, indices, command.instanceCount, command.baseVertex, command.baseInstance);
+	}
+}
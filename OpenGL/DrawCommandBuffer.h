@@ -0,0 +1,74 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+
+class RenderStateCache;
+
+// INDIRECT COMMAND
+// ----------------
+// Layout fixed by the GL spec for GL_DRAW_INDIRECT_BUFFER contents.
+struct DrawElementsIndirectCommand
+{
+	GLuint count;
+	GLuint instanceCount;
+	GLuint firstIndex;
+	GLint baseVertex;
+	GLuint baseInstance;
+};
+
+// DRAW COMMAND BUFFER
+// -------------------
+// Builds one DrawElementsIndirectCommand per visible object and submits the
+// whole list with a single glMultiDrawElementsIndirect (GL 4.3 or
+// ARB_multi_draw_indirect), so the CPU cost of a frame no longer grows with
+// the object count. Objects share one vertex array; baseInstance selects each
+// object's per-instance data (see InstanceBuffer), baseVertex/firstIndex its
+// mesh inside shared vertex and index buffers.
+// Without multi-draw support submit() falls back to one draw per command;
+// create() fails without base instance support (GL 4.2), since every command
+// would draw with the first object's data.
+// Pass the context's loader to create() to pick up ARB_indirect_parameters
+// on contexts older than 4.6.
+class DrawCommandBuffer
+{
+public:
+	~DrawCommandBuffer();
+	DrawCommandBuffer() = default;
+	DrawCommandBuffer(const DrawCommandBuffer&) = delete;
+	DrawCommandBuffer& operator=(const DrawCommandBuffer&) = delete;
+
+	bool create(RenderStateCache& state, int capacity, GLADloadproc loader = nullptr); // allocates storage for capacity commands
+	void destroy();
+
+	void clear() { m_commands.clear(); }
+	void add(const DrawElementsIndirectCommand& command) { m_commands.push_back(command); }
+	void add(GLuint count, GLuint firstIndex, GLint baseVertex, GLuint baseInstance, GLuint instanceCount = 1);
+	void upload(RenderStateCache& state); // grows the GL buffer when needed
+
+	// The vertex array (with its element buffer) must already be bound
+	void submit(RenderStateCache& state, GLenum mode, GLenum indexType) const;
+	// Draw count read from parameterBuffer at offset (GL 4.6 or
+	// ARB_indirect_parameters), for command lists written by the GPU, e.g. by a
+	// culling compute shader; falls back to reading the count back to the CPU,
+	// which stalls until the GPU has written it, and without multi-draw the
+	// commands are read back as well
+	void submitCount(RenderStateCache& state, GLenum mode, GLenum indexType, unsigned int parameterBuffer, GLintptr offset, int maxCount) const;
+
+	bool multiDraw() const { return m_multiDraw; }
+	bool drawCount() const { return m_drawCount; }
+	int size() const { return (int)m_commands.size(); }
+	unsigned int buffer() const { return m_buffer; }
+
+private:
+	void drawEach(GLenum mode, GLenum indexType, const DrawElementsIndirectCommand* commands, int count) const;
+	void countCommands(GLenum mode, int count) const;
+
+	unsigned int m_buffer{ 0 };
+	int m_capacity{ 0 };
+	int m_uploaded{ 0 };
+	bool m_multiDraw{ false };
+	bool m_drawCount{ false };
+	bool m_baseInstance{ false };
+	PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC m_multiDrawCountARB{ nullptr }; // ARB_indirect_parameters, loaded by hand
+	std::vector<DrawElementsIndirectCommand> m_commands{};
+};
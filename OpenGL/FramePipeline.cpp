@@ -0,0 +1,131 @@
+#include "FramePipeline.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <iostream>
+
+static double millisecondsBetween(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// CREATE
+// ------
+FramePipeline::~FramePipeline()
+{
+	destroy();
+}
+bool FramePipeline::create(int depth, Simulate simulate)
+{
+	destroy();
+	if (depth < 1 || !simulate)
+	{
+		std::cout << "Failed to create frame pipeline, depth " << depth << std::endl;
+		return false;
+	}
+	m_slots.assign(depth, Slot{});
+	m_simulate = std::move(simulate);
+	m_nextSimulate = 0;
+	m_nextRender = 0;
+	m_stats = FramePipelineStats{};
+	m_running = true;
+	m_thread = std::thread{ &FramePipeline::simulationLoop, this };
+	return true;
+}
+void FramePipeline::destroy()
+{
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		m_running = false;
+	}
+	m_changed.notify_all();
+	if (m_thread.joinable())
+		m_thread.join();
+	m_simulate = nullptr;
+}
+// SIMULATION THREAD
+// -----------------
+void FramePipeline::simulationLoop()
+{
+	Profiler::setThreadName("Simulation");
+	long long frame{ 0 };
+	while (true)
+	{
+		int slot{ 0 };
+		{
+			std::unique_lock<std::mutex> lock{ m_mutex };
+			Clock::time_point waitStart{ Clock::now() };
+			m_changed.wait(lock, [this] { return !m_running || m_slots[m_nextSimulate].state == SlotState::Free; });
+			if (!m_running)
+				return;
+			m_stats.simulationWaitMilliseconds += millisecondsBetween(waitStart, Clock::now());
+			slot = m_nextSimulate;
+			m_nextSimulate = (m_nextSimulate + 1) % (int)m_slots.size();
+			m_slots[slot].state = SlotState::Simulating;
+			m_slots[slot].frame = frame;
+			m_slots[slot].simulationStart = Clock::now();
+		}
+		{
+			PROFILE_SCOPE("Simulate");
+			m_simulate(slot, frame);
+		}
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			m_slots[slot].state = SlotState::Ready;
+		}
+		m_changed.notify_all();
+		++frame;
+	}
+}
+// RENDER THREAD
+// -------------
+int FramePipeline::beginRender()
+{
+	PROFILE_SCOPE("Wait for simulation");
+	std::unique_lock<std::mutex> lock{ m_mutex };
+	if (m_slots.empty())
+		return -1;
+	Clock::time_point waitStart{ Clock::now() };
+	m_changed.wait(lock, [this] { return !m_running || m_slots[m_nextRender].state == SlotState::Ready; });
+	if (m_slots[m_nextRender].state != SlotState::Ready)
+		return -1;
+	m_stats.renderWaitMilliseconds += millisecondsBetween(waitStart, Clock::now());
+	int slot{ m_nextRender };
+	m_nextRender = (m_nextRender + 1) % (int)m_slots.size();
+	m_slots[slot].state = SlotState::Rendering;
+	return slot;
+}
+void FramePipeline::endRender(int slot)
+{
+	Clock::time_point now{ Clock::now() };
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+		double latency{ millisecondsBetween(m_slots[slot].simulationStart, now) };
+		m_stats.latencyMilliseconds += latency;
+		m_stats.maxLatencyMilliseconds = std::max(m_stats.maxLatencyMilliseconds, latency);
+		if (m_stats.frames > 0)
+			m_stats.frameMilliseconds += millisecondsBetween(m_lastPresent, now);
+		++m_stats.frames;
+		m_lastPresent = now;
+		m_slots[slot].state = SlotState::Free;
+	}
+	m_changed.notify_all();
+}
+// STATISTICS
+// ----------
+FramePipelineStats FramePipeline::stats() const
+{
+	std::lock_guard<std::mutex> lock{ m_mutex };
+	return m_stats;
+}
+void FramePipeline::printStats() const
+{
+	FramePipelineStats stats{ this->stats() };
+	if (stats.frames == 0)
+		return;
+	double frame{ stats.averageFrame() };
+	std::cout << "Frame pipeline (depth " << depth() << "): " << stats.frames << " frames, " << frame << " ms/frame, latency "
+		<< stats.averageLatency() << " ms average (" << (frame > 0.0 ? stats.averageLatency() / frame : 0.0) << " frames), "
+		<< stats.maxLatencyMilliseconds << " ms max" << std::endl;
+	std::cout << "  simulation waited " << stats.simulationWaitMilliseconds / stats.frames << " ms/frame for a free slot, render waited "
+		<< stats.renderWaitMilliseconds / stats.frames << " ms/frame for a simulated frame" << std::endl;
+}
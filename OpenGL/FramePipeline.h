@@ -0,0 +1,95 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct FramePipelineStats
+{
+	long long frames{ 0 };
+	double latencyMilliseconds{ 0.0 };          // simulation start to presented, summed
+	double maxLatencyMilliseconds{ 0.0 };
+	double frameMilliseconds{ 0.0 };            // between presents, summed
+	double simulationWaitMilliseconds{ 0.0 };   // simulation blocked on a free slot (render bound)
+	double renderWaitMilliseconds{ 0.0 };       // render thread blocked on a simulated frame (simulation bound)
+
+	double averageLatency() const { return frames > 0 ? latencyMilliseconds / frames : 0.0; }
+	double averageFrame() const { return frames > 1 ? frameMilliseconds / (frames - 1) : 0.0; }
+};
+
+// FRAME PIPELINE
+// --------------
+// Runs the simulation on its own thread, up to depth frames ahead of the
+// render thread. Frame data is double (or more) buffered: the simulate
+// callback fills slot s for frame N + 1 while the render thread draws from
+// the slot of frame N, and a slot is only reused after endRender() handed it
+// back. The application owns one frame data object per slot, indexed by the
+// slot number:
+//
+//   pipeline.create(2, [&](int slot, long long frame) { simulate(frames[slot], frame); });
+//   while (...)
+//   {
+//       int slot{ pipeline.beginRender() };
+//       render(frames[slot]);
+//       context.swapBuffers();
+//       pipeline.endRender(slot);
+//   }
+//
+// Depth 1 simulates and renders strictly in turn, each extra slot lets the
+// simulation run one more frame ahead and adds up to a frame of latency.
+class FramePipeline
+{
+public:
+	using Simulate = std::function<void(int slot, long long frame)>;
+
+	FramePipeline() = default;
+	~FramePipeline();
+	FramePipeline(const FramePipeline&) = delete;
+	FramePipeline& operator=(const FramePipeline&) = delete;
+
+	bool create(int depth, Simulate simulate);
+	void destroy(); // stops the simulation thread after the frame it is on, keeps the stats
+
+	// Render thread: waits for the oldest simulated frame and returns its slot,
+	// -1 once the pipeline was destroyed
+	int beginRender();
+	// After the frame was presented: records its latency, frees the slot
+	void endRender(int slot);
+
+	int depth() const { return (int)m_slots.size(); }
+	FramePipelineStats stats() const;
+	void printStats() const;
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	enum class SlotState
+	{
+		Free,
+		Simulating,
+		Ready,
+		Rendering
+	};
+
+	struct Slot
+	{
+		SlotState state{ SlotState::Free };
+		long long frame{ 0 };
+		Clock::time_point simulationStart{};
+	};
+
+	void simulationLoop();
+
+	std::vector<Slot> m_slots{};
+	Simulate m_simulate{};
+	std::thread m_thread{};
+	mutable std::mutex m_mutex{};
+	std::condition_variable m_changed{};
+	bool m_running{ false };
+	int m_nextSimulate{ 0 };
+	int m_nextRender{ 0 };
+	Clock::time_point m_lastPresent{};
+	FramePipelineStats m_stats{};
+};
@@ -0,0 +1,179 @@
+#include "FrameStats.h"
+#include "RenderState.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+static thread_local long long drawCalls{ 0 };
+static thread_local long long triangles{ 0 };
+static thread_local long long uploadBytes{ 0 };
+
+// DRAW AND UPLOAD COUNTING
+// ------------------------
+static long long trianglesFor(GLenum mode, long long vertices)
+{
+	switch (mode)
+	{
+	case GL_TRIANGLES: return vertices / 3;
+	case GL_TRIANGLE_STRIP:
+	case GL_TRIANGLE_FAN: return vertices > 2 ? vertices - 2 : 0;
+	default: return 0;
+	}
+}
+void countDraw(GLenum mode, long long vertices, long long instances)
+{
+	countDrawCall();
+	countPrimitives(mode, vertices, instances);
+}
+void countDrawCall()
+{
+	++drawCalls;
+}
+void countPrimitives(GLenum mode, long long vertices, long long instances)
+{
+	triangles += trianglesFor(mode, vertices) * instances;
+}
+void countUpload(long long bytes)
+{
+	uploadBytes += bytes;
+}
+// FRAMES
+// ------
+static long long steadyNanoseconds()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+FrameStats::FrameStats(int window)
+	: m_window{ std::max(window, 1) }
+{
+	m_frames.reserve(m_window);
+}
+void FrameStats::beginFrame()
+{
+	drawCalls = triangles = uploadBytes = 0;
+	m_frameStart = steadyNanoseconds();
+}
+void FrameStats::endFrame(const RenderStateCache& state)
+{
+	FrameCounters frame{};
+	frame.cpuMilliseconds = (steadyNanoseconds() - m_frameStart) / 1000000.0;
+	frame.drawCalls = drawCalls;
+	frame.triangles = triangles;
+	frame.uploadBytes = uploadBytes;
+	frame.stateChanges = state.frame().issued;
+	frame.programSwitches = state.frame().programSwitches;
+	frame.textureBinds = state.frame().textureBinds;
+	if (m_checkErrors)
+	{
+		// Every error flag set since the last check, GL keeps at most one per kind
+		while (glGetError() != GL_NO_ERROR && frame.glErrors < 32)
+			++frame.glErrors;
+	}
+	if ((int)m_frames.size() < m_window)
+		m_frames.push_back(frame);
+	else
+		m_frames[m_next] = frame;
+	m_next = (m_next + 1) % m_window;
+	++m_frameCount;
+	drawCalls = triangles = uploadBytes = 0;
+}
+const FrameCounters& FrameStats::lastFrame() const
+{
+	static const FrameCounters empty{};
+	if (m_frames.empty())
+		return empty;
+	return m_frames[(m_next + m_window - 1) % m_window];
+}
+// SUMMARIES
+// ---------
+// p99 is nearest rank: the smallest value at least 99% of the frames reach
+CounterSummary FrameStats::summarize(std::vector<double>& values) const
+{
+	CounterSummary summary{};
+	if (values.empty())
+		return summary;
+	std::sort(values.begin(), values.end());
+	double total{ 0.0 };
+	for (double value : values)
+		total += value;
+	std::size_t rank{ (values.size() * 99 + 99) / 100 };
+	summary.minimum = values.front();
+	summary.average = total / values.size();
+	summary.p99 = values[std::min(rank, values.size()) - 1];
+	summary.maximum = values.back();
+	return summary;
+}
+CounterSummary FrameStats::summarize(double FrameCounters::* counter) const
+{
+	std::vector<double> values{};
+	values.reserve(m_frames.size());
+	for (const FrameCounters& frame : m_frames)
+		values.push_back(frame.*counter);
+	return summarize(values);
+}
+CounterSummary FrameStats::summarize(long long FrameCounters::* counter) const
+{
+	std::vector<double> values{};
+	values.reserve(m_frames.size());
+	for (const FrameCounters& frame : m_frames)
+		values.push_back((double)(frame.*counter));
+	return summarize(values);
+}
+// OUTPUT
+// ------
+void FrameStats::print() const
+{
+	if (m_frames.empty())
+		return;
+	struct Row
+	{
+		const char* name;
+		CounterSummary summary;
+	};
+	const Row rows[]
+	{
+		{ "CPU frame ms", summarize(&FrameCounters::cpuMilliseconds) },
+		{ "Draw calls", summarize(&FrameCounters::drawCalls) },
+		{ "Triangles", summarize(&FrameCounters::triangles) },
+		{ "State changes", summarize(&FrameCounters::stateChanges) },
+		{ "Program switches", summarize(&FrameCounters::programSwitches) },
+		{ "Texture binds", summarize(&FrameCounters::textureBinds) },
+		{ "Upload bytes", summarize(&FrameCounters::uploadBytes) },
+		{ "GL errors", summarize(&FrameCounters::glErrors) },
+	};
+	std::ios_base::fmtflags flags{ std::cout.flags() };
+	std::streamsize precision{ std::cout.precision() };
+	std::cout << "Frame stats over the last " << m_frames.size() << " of " << m_frameCount << " frames (min/avg/p99/max):" << std::endl;
+	std::cout << std::fixed << std::setprecision(3);
+	for (const Row& row : rows)
+	{
+		std::cout << "  " << std::left << std::setw(18) << row.name << std::right << std::setw(12) << row.summary.minimum
+			<< std::setw(12) << row.summary.average << std::setw(12) << row.summary.p99 << std::setw(12) << row.summary.maximum << std::endl;
+	}
+	std::cout.flags(flags);
+	std::cout.precision(precision);
+}
+bool FrameStats::writeCsv(const std::string& path) const
+{
+	std::ofstream file{ path };
+	if (!file)
+	{
+		std::cout << "Failed to open stats output " << path << std::endl;
+		return false;
+	}
+	file << "frame,cpu_ms,draw_calls,triangles,state_changes,program_switches,texture_binds,upload_bytes,gl_errors\n";
+	file << std::fixed << std::setprecision(4);
+	// Oldest first
+	long long number{ m_frameCount - (long long)m_frames.size() };
+	for (std::size_t i{ 0 }; i < m_frames.size(); ++i)
+	{
+		const FrameCounters& frame{ m_frames[(m_frames.size() < (std::size_t)m_window ? i : (m_next + i) % m_window)] };
+		file << number++ << ',' << frame.cpuMilliseconds << ',' << frame.drawCalls << ',' << frame.triangles << ','
+			<< frame.stateChanges << ',' << frame.programSwitches << ',' << frame.textureBinds << ','
+			<< frame.uploadBytes << ',' << frame.glErrors << '\n';
+	}
+	std::cout << "Wrote " << m_frames.size() << " frames of stats to " << path << std::endl;
+	return (bool)file;
+}
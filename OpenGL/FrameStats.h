@@ -0,0 +1,78 @@
+#pragma once
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+
+class RenderStateCache;
+
+// DRAW AND UPLOAD COUNTING
+// ------------------------
+// Called by the engine wherever a draw or a buffer/texture upload reaches GL.
+// The counters are per thread and FrameStats reads those of the thread that
+// renders, so uploads from a loader thread's shared context don't show up.
+// Multi-draws count one call and the primitives of every command they draw.
+void countDraw(GLenum mode, long long vertices, long long instances = 1);
+void countDrawCall();
+void countPrimitives(GLenum mode, long long vertices, long long instances = 1);
+void countUpload(long long bytes);
+
+// FRAME COUNTERS
+// --------------
+struct FrameCounters
+{
+	double cpuMilliseconds{ 0.0 };
+	long long drawCalls{ 0 };
+	long long triangles{ 0 };
+	long long stateChanges{ 0 }; // state calls that reached GL through the RenderStateCache
+	long long programSwitches{ 0 };
+	long long textureBinds{ 0 };
+	long long uploadBytes{ 0 };
+	long long glErrors{ 0 };
+};
+
+struct CounterSummary
+{
+	double minimum{ 0.0 };
+	double average{ 0.0 };
+	double p99{ 0.0 };
+	double maximum{ 0.0 };
+};
+
+// FRAME STATS
+// -----------
+// Collects one FrameCounters per frame into a window of the newest frames and
+// summarizes each counter as min/avg/p99/max over it, printed or written as
+// CSV so scenes can be compared between builds. endFrame() takes the draw and
+// upload counts gathered since the previous frame and the RenderStateCache's
+// counters for the frame (call it before the cache's next beginFrame()).
+// glGetError is polled at every endFrame() unless disabled, on threaded
+// drivers that is a round trip.
+class FrameStats
+{
+public:
+	explicit FrameStats(int window = 600);
+
+	void setCheckErrors(bool enabled) { m_checkErrors = enabled; }
+
+	void beginFrame();
+	void endFrame(const RenderStateCache& state);
+
+	const FrameCounters& lastFrame() const;
+	long long frameCount() const { return m_frameCount; }
+	int windowSize() const { return (int)m_frames.size(); }
+	CounterSummary summarize(double FrameCounters::* counter) const;
+	CounterSummary summarize(long long FrameCounters::* counter) const;
+
+	void print() const;
+	bool writeCsv(const std::string& path) const; // one row per frame in the window
+
+private:
+	CounterSummary summarize(std::vector<double>& values) const;
+
+	std::vector<FrameCounters> m_frames{};
+	int m_window;
+	int m_next{ 0 };
+	long long m_frameCount{ 0 };
+	bool m_checkErrors{ true };
+	long long m_frameStart{ 0 };
+};
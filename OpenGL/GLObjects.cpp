@@ -0,0 +1,510 @@
+#include "GLObjects.h"
+#include "FrameStats.h"
+#include "ProgramCache.h"
+#include <iostream>
+#include <utility>
+
+// glad loads these entry points only with the core version that introduced
+// them, not for the ARB extensions, so check the pointers the wrappers call
+bool hasDirectStateAccess()
+{
+	return glCreateBuffers != NULL && glNamedBufferStorage != NULL && glNamedBufferSubData != NULL
+		&& glMapNamedBufferRange != NULL && glUnmapNamedBuffer != NULL
+		&& glCreateVertexArrays != NULL && glEnableVertexArrayAttrib != NULL && glVertexArrayAttribFormat != NULL
+		&& glVertexArrayAttribBinding != NULL && glVertexArrayBindingDivisor != NULL
+		&& glVertexArrayVertexBuffer != NULL && glVertexArrayElementBuffer != NULL
+		&& glCreateTextures != NULL && glTextureStorage2D != NULL && glTextureSubImage2D != NULL
+		&& glTextureParameteri != NULL && glGenerateTextureMipmap != NULL;
+}
+// BUFFER
+// ------
+Buffer::~Buffer()
+{
+	destroy();
+}
+Buffer::Buffer(Buffer&& other) noexcept
+{
+	*this = std::move(other);
+}
+Buffer& Buffer::operator=(Buffer&& other) noexcept
+{
+	std::swap(m_id, other.m_id);
+	std::swap(m_size, other.m_size);
+	std::swap(m_direct, other.m_direct);
+	return *this;
+}
+bool Buffer::create(GLsizeiptr size, const void* data, GLbitfield flags)
+{
+	destroy();
+	m_direct = hasDirectStateAccess();
+	m_size = size;
+	if (m_direct)
+	{
+		glCreateBuffers(1, &m_id);
+		glNamedBufferStorage(m_id, size, data, flags);
+	}
+	else
+	{
+		glGenBuffers(1, &m_id);
+		int previous{ 0 };
+		glGetIntegerv(GL_COPY_WRITE_BUFFER_BINDING, &previous);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, m_id);
+		if (glBufferStorage != NULL)
+			glBufferStorage(GL_COPY_WRITE_BUFFER, size, data, flags);
+		else
+			glBufferData(GL_COPY_WRITE_BUFFER, size, data, (flags & GL_DYNAMIC_STORAGE_BIT) ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, previous);
+	}
+	if (m_id == 0)
+	{
+		std::cout << "Buffer failed to create" << std::endl;
+		return false;
+	}
+	if (data != nullptr)
+		countUpload(size);
+	return true;
+}
+void Buffer::destroy()
+{
+	if (m_id != 0)
+		glDeleteBuffers(1, &m_id);
+	m_id = 0;
+	m_size = 0;
+}
+void Buffer::update(GLintptr offset, GLsizeiptr size, const void* data)
+{
+	countUpload(size);
+	if (m_direct)
+	{
+		glNamedBufferSubData(m_id, offset, size, data);
+		return;
+	}
+	int previous{ 0 };
+	glGetIntegerv(GL_COPY_WRITE_BUFFER_BINDING, &previous);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, m_id);
+	glBufferSubData(GL_COPY_WRITE_BUFFER, offset, size, data);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, previous);
+}
+void* Buffer::map(GLintptr offset, GLsizeiptr size, GLbitfield access)
+{
+	if (m_direct)
+		return glMapNamedBufferRange(m_id, offset, size, access);
+	int previous{ 0 };
+	glGetIntegerv(GL_COPY_WRITE_BUFFER_BINDING, &previous);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, m_id);
+	void* pointer{ glMapBufferRange(GL_COPY_WRITE_BUFFER, offset, size, access) };
+	glBindBuffer(GL_COPY_WRITE_BUFFER, previous);
+	return pointer;
+}
+void Buffer::unmap()
+{
+	if (m_direct)
+	{
+		glUnmapNamedBuffer(m_id);
+		return;
+	}
+	int previous{ 0 };
+	glGetIntegerv(GL_COPY_WRITE_BUFFER_BINDING, &previous);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, m_id);
+	glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, previous);
+}
+// VERTEX ARRAY
+// ------------
+VertexArray::~VertexArray()
+{
+	destroy();
+}
+VertexArray::VertexArray(VertexArray&& other) noexcept
+{
+	*this = std::move(other);
+}
+VertexArray& VertexArray::operator=(VertexArray&& other) noexcept
+{
+	std::swap(m_id, other.m_id);
+	std::swap(m_direct, other.m_direct);
+	std::swap(m_bindings, other.m_bindings);
+	std::swap(m_attributes, other.m_attributes);
+	return *this;
+}
+bool VertexArray::create()
+{
+	destroy();
+	m_direct = hasDirectStateAccess();
+	if (m_direct)
+		glCreateVertexArrays(1, &m_id);
+	else
+		glGenVertexArrays(1, &m_id);
+	if (m_id == 0)
+	{
+		std::cout << "Vertex array failed to create" << std::endl;
+		return false;
+	}
+	return true;
+}
+void VertexArray::destroy()
+{
+	if (m_id != 0)
+		glDeleteVertexArrays(1, &m_id);
+	m_id = 0;
+	for (BindingSlot& binding : m_bindings)
+		binding = BindingSlot{};
+	for (Attribute& attribute : m_attributes)
+		attribute = Attribute{};
+}
+void VertexArray::setVertexBuffer(unsigned int binding, const Buffer& buffer, GLintptr offset, GLsizei stride)
+{
+	if (binding >= (unsigned int)MAX_ATTRIBUTES)
+		return;
+	if (m_direct)
+	{
+		glVertexArrayVertexBuffer(m_id, binding, buffer.id(), offset, stride);
+		return;
+	}
+	m_bindings[binding].buffer = buffer.id();
+	m_bindings[binding].offset = offset;
+	m_bindings[binding].stride = stride;
+	int previousArray{ 0 }, previousBuffer{ 0 };
+	glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &previousArray);
+	glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &previousBuffer);
+	glBindVertexArray(m_id);
+	for (unsigned int location{ 0 }; location < (unsigned int)MAX_ATTRIBUTES; ++location)
+	{
+		if (m_attributes[location].binding == binding)
+			applyFallback(location);
+	}
+	glBindVertexArray(previousArray);
+	glBindBuffer(GL_ARRAY_BUFFER, previousBuffer);
+}
+void VertexArray::setIndexBuffer(const Buffer& buffer)
+{
+	if (m_direct)
+	{
+		glVertexArrayElementBuffer(m_id, buffer.id());
+		return;
+	}
+	// The element array binding is vertex array state, restoring the vertex array restores it
+	int previousArray{ 0 };
+	glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &previousArray);
+	glBindVertexArray(m_id);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer.id());
+	glBindVertexArray(previousArray);
+}
+void VertexArray::setAttribute(unsigned int location, unsigned int binding, int size, GLenum type, bool normalized, unsigned int relativeOffset)
+{
+	if (location >= (unsigned int)MAX_ATTRIBUTES || binding >= (unsigned int)MAX_ATTRIBUTES)
+		return;
+	if (m_direct)
+	{
+		glEnableVertexArrayAttrib(m_id, location);
+		glVertexArrayAttribFormat(m_id, location, size, type, normalized ? GL_TRUE : GL_FALSE, relativeOffset);
+		glVertexArrayAttribBinding(m_id, location, binding);
+		return;
+	}
+	m_attributes[location] = Attribute{ true, binding, size, type, normalized, relativeOffset };
+	int previousArray{ 0 }, previousBuffer{ 0 };
+	glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &previousArray);
+	glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &previousBuffer);
+	glBindVertexArray(m_id);
+	applyFallback(location);
+	glBindVertexArray(previousArray);
+	glBindBuffer(GL_ARRAY_BUFFER, previousBuffer);
+}
+void VertexArray::setDivisor(unsigned int binding, unsigned int divisor)
+{
+	if (binding >= (unsigned int)MAX_ATTRIBUTES)
+		return;
+	if (m_direct)
+	{
+		glVertexArrayBindingDivisor(m_id, binding, divisor);
+		return;
+	}
+	m_bindings[binding].divisor = divisor;
+	int previousArray{ 0 };
+	glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &previousArray);
+	glBindVertexArray(m_id);
+	for (unsigned int location{ 0 }; location < (unsigned int)MAX_ATTRIBUTES; ++location)
+	{
+		if (m_attributes[location].enabled && m_attributes[location].binding == binding)
+			glVertexAttribDivisor(location, divisor);
+	}
+	glBindVertexArray(previousArray);
+}
+void VertexArray::applyFallback(unsigned int location) const
+{
+	const Attribute& attribute{ m_attributes[location] };
+	const BindingSlot& binding{ m_bindings[attribute.binding] };
+	// Core profiles reject attribute pointers without a buffer; wait for setVertexBuffer
+	if (!attribute.enabled || binding.buffer == 0)
+		return;
+	glBindBuffer(GL_ARRAY_BUFFER, binding.buffer);
+	glVertexAttribPointer(location, attribute.size, attribute.type, attribute.normalized ? GL_TRUE : GL_FALSE,
+		binding.stride, (void*)(binding.offset + attribute.relativeOffset));
+	glVertexAttribDivisor(location, binding.divisor);
+	glEnableVertexAttribArray(location);
+}
+// TEXTURE
+// -------
+Texture::~Texture()
+{
+	destroy();
+}
+Texture::Texture(Texture&& other) noexcept
+{
+	*this = std::move(other);
+}
+Texture& Texture::operator=(Texture&& other) noexcept
+{
+	std::swap(m_id, other.m_id);
+	std::swap(m_width, other.m_width);
+	std::swap(m_height, other.m_height);
+	std::swap(m_direct, other.m_direct);
+	return *this;
+}
+static long long pixelSize(GLenum format, GLenum type)
+{
+	long long components{ format == GL_RED ? 1 : format == GL_RG ? 2 : format == GL_RGB || format == GL_BGR ? 3 : 4 };
+	long long componentSize{ type == GL_FLOAT || type == GL_INT || type == GL_UNSIGNED_INT ? 4
+		: type == GL_HALF_FLOAT || type == GL_SHORT || type == GL_UNSIGNED_SHORT ? 2 : 1 };
+	return components * componentSize;
+}
+// Format and type only matter for glTexImage2D's (empty) upload; they just have to be legal for the internal format
+static void fallbackFormat(GLenum internalFormat, GLenum& format, GLenum& type)
+{
+	switch (internalFormat)
+	{
+	case GL_DEPTH_COMPONENT16:
+	case GL_DEPTH_COMPONENT24:
+	case GL_DEPTH_COMPONENT32F:
+		format = GL_DEPTH_COMPONENT;
+		type = GL_FLOAT;
+		return;
+	case GL_DEPTH24_STENCIL8:
+		format = GL_DEPTH_STENCIL;
+		type = GL_UNSIGNED_INT_24_8;
+		return;
+	case GL_R8UI:
+	case GL_R32UI:
+	case GL_RG32UI:
+	case GL_RGBA8UI:
+	case GL_RGBA32UI:
+		format = GL_RED_INTEGER;
+		type = GL_UNSIGNED_INT;
+		return;
+	default:
+		format = GL_RGBA;
+		type = GL_UNSIGNED_BYTE;
+		return;
+	}
+}
+bool Texture::create2D(GLsizei width, GLsizei height, GLenum internalFormat, int levels)
+{
+	destroy();
+	m_direct = hasDirectStateAccess();
+	m_width = width;
+	m_height = height;
+	if (levels < 1)
+		levels = 1;
+	if (m_direct)
+	{
+		glCreateTextures(GL_TEXTURE_2D, 1, &m_id);
+		glTextureStorage2D(m_id, levels, internalFormat, width, height);
+	}
+	else
+	{
+		glGenTextures(1, &m_id);
+		int previous{ 0 };
+		glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+		glBindTexture(GL_TEXTURE_2D, m_id);
+		if (glTexStorage2D != NULL)
+			glTexStorage2D(GL_TEXTURE_2D, levels, internalFormat, width, height);
+		else
+		{
+			GLenum format, type;
+			fallbackFormat(internalFormat, format, type);
+			for (int level{ 0 }; level < levels; ++level)
+			{
+				GLsizei levelWidth{ width >> level > 0 ? width >> level : 1 };
+				GLsizei levelHeight{ height >> level > 0 ? height >> level : 1 };
+				glTexImage2D(GL_TEXTURE_2D, level, internalFormat, levelWidth, levelHeight, 0, format, type, NULL);
+			}
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+		}
+		glBindTexture(GL_TEXTURE_2D, previous);
+	}
+	if (m_id == 0)
+	{
+		std::cout << "Texture failed to create" << std::endl;
+		return false;
+	}
+	return true;
+}
+void Texture::destroy()
+{
+	if (m_id != 0)
+		glDeleteTextures(1, &m_id);
+	m_id = 0;
+	m_width = m_height = 0;
+}
+void Texture::upload(int level, int x, int y, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels)
+{
+	countUpload((long long)width * height * pixelSize(format, type));
+	if (m_direct)
+	{
+		glTextureSubImage2D(m_id, level, x, y, width, height, format, type, pixels);
+		return;
+	}
+	int previous{ 0 };
+	glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+	glBindTexture(GL_TEXTURE_2D, m_id);
+	glTexSubImage2D(GL_TEXTURE_2D, level, x, y, width, height, format, type, pixels);
+	glBindTexture(GL_TEXTURE_2D, previous);
+}
+void Texture::generateMipmaps()
+{
+	if (m_direct)
+	{
+		glGenerateTextureMipmap(m_id);
+		return;
+	}
+	int previous{ 0 };
+	glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+	glBindTexture(GL_TEXTURE_2D, m_id);
+	glGenerateMipmap(GL_TEXTURE_2D);
+	glBindTexture(GL_TEXTURE_2D, previous);
+}
+void Texture::setParameter(GLenum name, GLint value)
+{
+	if (m_direct)
+	{
+		glTextureParameteri(m_id, name, value);
+		return;
+	}
+	int previous{ 0 };
+	glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+	glBindTexture(GL_TEXTURE_2D, m_id);
+	glTexParameteri(GL_TEXTURE_2D, name, value);
+	glBindTexture(GL_TEXTURE_2D, previous);
+}
+void Texture::setFilter(GLenum minFilter, GLenum magFilter)
+{
+	setParameter(GL_TEXTURE_MIN_FILTER, (GLint)minFilter);
+	setParameter(GL_TEXTURE_MAG_FILTER, (GLint)magFilter);
+}
+void Texture::setWrap(GLenum wrapS, GLenum wrapT)
+{
+	setParameter(GL_TEXTURE_WRAP_S, (GLint)wrapS);
+	setParameter(GL_TEXTURE_WRAP_T, (GLint)wrapT);
+}
+// PROGRAM
+// -------
+Program::~Program()
+{
+	destroy();
+}
+Program::Program(Program&& other) noexcept
+{
+	*this = std::move(other);
+}
+Program& Program::operator=(Program&& other) noexcept
+{
+	std::swap(m_id, other.m_id);
+	std::swap(m_separate, other.m_separate);
+	return *this;
+}
+bool Program::create(const char* vertexSource, const char* fragmentSource)
+{
+	destroy();
+	m_separate = glProgramUniform1i != NULL && glProgramUniform1f != NULL && glProgramUniform3f != NULL
+		&& glProgramUniform4f != NULL && glProgramUniformMatrix4fv != NULL;
+	unsigned int vertexShader{ compileShader(GL_VERTEX_SHADER, vertexSource) };
+	unsigned int fragmentShader{ compileShader(GL_FRAGMENT_SHADER, fragmentSource) };
+	if (vertexShader != 0 && fragmentShader != 0)
+		m_id = linkProgram(vertexShader, fragmentShader, false);
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+	return m_id != 0;
+}
+void Program::destroy()
+{
+	if (m_id != 0)
+		glDeleteProgram(m_id);
+	m_id = 0;
+}
+int Program::uniformLocation(const char* name) const
+{
+	return glGetUniformLocation(m_id, name);
+}
+bool Program::beginFallback(int& previous) const
+{
+	glGetIntegerv(GL_CURRENT_PROGRAM, &previous);
+	if ((unsigned int)previous == m_id)
+		return false;
+	glUseProgram(m_id);
+	return true;
+}
+void Program::setUniform(int location, int value)
+{
+	if (m_separate)
+	{
+		glProgramUniform1i(m_id, location, value);
+		return;
+	}
+	int previous{ 0 };
+	bool switched{ beginFallback(previous) };
+	glUniform1i(location, value);
+	if (switched)
+		glUseProgram(previous);
+}
+void Program::setUniform(int location, float value)
+{
+	if (m_separate)
+	{
+		glProgramUniform1f(m_id, location, value);
+		return;
+	}
+	int previous{ 0 };
+	bool switched{ beginFallback(previous) };
+	glUniform1f(location, value);
+	if (switched)
+		glUseProgram(previous);
+}
+void Program::setUniform(int location, float x, float y, float z)
+{
+	if (m_separate)
+	{
+		glProgramUniform3f(m_id, location, x, y, z);
+		return;
+	}
+	int previous{ 0 };
+	bool switched{ beginFallback(previous) };
+	glUniform3f(location, x, y, z);
+	if (switched)
+		glUseProgram(previous);
+}
+void Program::setUniform(int location, float x, float y, float z, float w)
+{
+	if (m_separate)
+	{
+		glProgramUniform4f(m_id, location, x, y, z, w);
+		return;
+	}
+	int previous{ 0 };
+	bool switched{ beginFallback(previous) };
+	glUniform4f(location, x, y, z, w);
+	if (switched)
+		glUseProgram(previous);
+}
+void Program::setUniformMatrix4(int location, const float* matrix)
+{
+	if (m_separate)
+	{
+		glProgramUniformMatrix4fv(m_id, location, 1, GL_FALSE, matrix);
+		return;
+	}
+	int previous{ 0 };
+	bool switched{ beginFallback(previous) };
+	glUniformMatrix4fv(location, 1, GL_FALSE, matrix);
+	if (switched)
+		glUseProgram(previous);
+}
@@ -0,0 +1,162 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstddef>
+
+// GL OBJECTS
+// ----------
+// Owning wrappers for buffers, vertex arrays, textures and programs. Objects
+// are configured through GL 4.5 direct state access (glNamedBufferStorage,
+// glVertexArrayVertexBuffer, glTextureStorage2D, glProgramUniform...), so
+// setting one up never touches the bindings the render loop relies on and
+// never invalidates a RenderStateCache.
+// Contexts where glad did not load the 4.5 entry points take a fallback that
+// binds the object to edit it and restores the previous binding after.
+// Each wrapper deletes its object when destroyed; they move but do not copy.
+bool hasDirectStateAccess(); // for the current context
+
+// BUFFER
+// ------
+class Buffer
+{
+public:
+	Buffer() = default;
+	~Buffer();
+	Buffer(Buffer&& other) noexcept;
+	Buffer& operator=(Buffer&& other) noexcept;
+	Buffer(const Buffer&) = delete;
+	Buffer& operator=(const Buffer&) = delete;
+
+	// Immutable storage; include GL_DYNAMIC_STORAGE_BIT to update() it later
+	bool create(GLsizeiptr size, const void* data, GLbitfield flags = 0);
+	void destroy();
+	void update(GLintptr offset, GLsizeiptr size, const void* data);
+	void* map(GLintptr offset, GLsizeiptr size, GLbitfield access);
+	void unmap();
+
+	unsigned int id() const { return m_id; }
+	GLsizeiptr size() const { return m_size; }
+
+private:
+	unsigned int m_id{ 0 };
+	GLsizeiptr m_size{ 0 };
+	bool m_direct{ false };
+};
+
+// VERTEX ARRAY
+// ------------
+// Separates attribute formats from buffer bindings (the 4.3 vertex attrib
+// binding model): attributes read from a binding slot, buffers are attached
+// to slots. The fallback records both and re-issues glVertexAttribPointer.
+class VertexArray
+{
+public:
+	VertexArray() = default;
+	~VertexArray();
+	VertexArray(VertexArray&& other) noexcept;
+	VertexArray& operator=(VertexArray&& other) noexcept;
+	VertexArray(const VertexArray&) = delete;
+	VertexArray& operator=(const VertexArray&) = delete;
+
+	bool create();
+	void destroy();
+	void setVertexBuffer(unsigned int binding, const Buffer& buffer, GLintptr offset, GLsizei stride);
+	void setIndexBuffer(const Buffer& buffer);
+	void setAttribute(unsigned int location, unsigned int binding, int size, GLenum type, bool normalized, unsigned int relativeOffset);
+	void setDivisor(unsigned int binding, unsigned int divisor);
+
+	unsigned int id() const { return m_id; }
+
+	static constexpr int MAX_ATTRIBUTES{ 16 };
+
+private:
+	struct BindingSlot
+	{
+		unsigned int buffer{ 0 };
+		GLintptr offset{ 0 };
+		GLsizei stride{ 0 };
+		unsigned int divisor{ 0 };
+	};
+	struct Attribute
+	{
+		bool enabled{ false };
+		unsigned int binding{ 0 };
+		int size{ 0 };
+		GLenum type{ 0 };
+		bool normalized{ false };
+		unsigned int relativeOffset{ 0 };
+	};
+
+	void applyFallback(unsigned int location) const; // call with the vertex array bound
+
+	unsigned int m_id{ 0 };
+	bool m_direct{ false };
+	BindingSlot m_bindings[MAX_ATTRIBUTES]{};
+	Attribute m_attributes[MAX_ATTRIBUTES]{};
+};
+
+// TEXTURE
+// -------
+// 2D textures with immutable storage. Bind them for drawing through
+// RenderStateCache::bindTexture(unit, GL_TEXTURE_2D, texture.id()).
+class Texture
+{
+public:
+	Texture() = default;
+	~Texture();
+	Texture(Texture&& other) noexcept;
+	Texture& operator=(Texture&& other) noexcept;
+	Texture(const Texture&) = delete;
+	Texture& operator=(const Texture&) = delete;
+
+	bool create2D(GLsizei width, GLsizei height, GLenum internalFormat, int levels = 1);
+	void destroy();
+	void upload(int level, int x, int y, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels);
+	void generateMipmaps();
+	void setFilter(GLenum minFilter, GLenum magFilter);
+	void setWrap(GLenum wrapS, GLenum wrapT);
+
+	unsigned int id() const { return m_id; }
+	GLsizei width() const { return m_width; }
+	GLsizei height() const { return m_height; }
+
+private:
+	void setParameter(GLenum name, GLint value);
+
+	unsigned int m_id{ 0 };
+	GLsizei m_width{ 0 };
+	GLsizei m_height{ 0 };
+	bool m_direct{ false };
+};
+
+// PROGRAM
+// -------
+// Uniforms go through glProgramUniform* (GL 4.1), which does not need the
+// program to be current; older contexts switch programs and switch back.
+class Program
+{
+public:
+	Program() = default;
+	~Program();
+	Program(Program&& other) noexcept;
+	Program& operator=(Program&& other) noexcept;
+	Program(const Program&) = delete;
+	Program& operator=(const Program&) = delete;
+
+	bool create(const char* vertexSource, const char* fragmentSource); // prints the info log on failure
+	void destroy();
+
+	int uniformLocation(const char* name) const;
+	void setUniform(int location, int value);
+	void setUniform(int location, float value);
+	void setUniform(int location, float x, float y, float z);
+	void setUniform(int location, float x, float y, float z, float w);
+	void setUniformMatrix4(int location, const float* matrix); // column major
+
+	unsigned int id() const { return m_id; }
+
+private:
+	bool beginFallback(int& previous) const; // true when the program had to be made current
+
+	unsigned int m_id{ 0 };
+	bool m_separate{ false };
+};
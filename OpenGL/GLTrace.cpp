@@ -0,0 +1,713 @@
+#include "GLTrace.h"
+#include <iostream>
+#include <mutex>
+#ifdef ENGINE_GL_TRACE
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// FUNCTION TABLE
+// --------------
+enum TraceFunction : std::uint16_t
+{
+#define GLAD_PROC(version, type, ret, name, params, args) TRACE_gl##name,
+#include <glad/glad_procs.h>
+	TRACE_FUNCTION_COUNT
+};
+
+static const char* functionNames[]
+{
+#define GLAD_PROC(version, type, ret, name, params, args) "gl" #name,
+#include <glad/glad_procs.h>
+};
+
+// The real entry points while tracing, glad's pointers point at the wrappers
+#define GLAD_PROC(version, type, ret, name, params, args) static type real_gl##name{ nullptr };
+#include <glad/glad_procs.h>
+
+template<typename F>
+struct FunctionShape;
+template<typename R, typename... A>
+struct FunctionShape<R(APIENTRY*)(A...)>
+{
+	static constexpr int arity{ (int)sizeof...(A) };
+	static constexpr bool lastIsPointer{ sizeof...(A) > 0 && std::is_pointer<typename std::tuple_element<sizeof...(A) == 0 ? 0 : sizeof...(A) - 1, std::tuple<A..., void*>>::type>::value };
+};
+static const int functionArity[]
+{
+#define GLAD_PROC(version, type, ret, name, params, args) FunctionShape<type>::arity,
+#include <glad/glad_procs.h>
+};
+static const bool functionLastIsPointer[]
+{
+#define GLAD_PROC(version, type, ret, name, params, args) FunctionShape<type>::lastIsPointer,
+#include <glad/glad_procs.h>
+};
+
+// TRACE STATE
+// -----------
+// How the pointer argument of a function is captured, derived from its name
+enum class PointerRule : std::uint8_t
+{
+	None,
+	UniformArray,  // glUniform*v / glProgramUniform*v, count * components
+	NameInput,     // glDelete*s, glDrawBuffers, ... n names or enums
+	NameOutput,    // glGen*s / glCreate*s, the names written by the call
+	Special        // handled by name in captureInputs()
+};
+struct UniformShape
+{
+	int countArgument;
+	int valueArgument;
+	int elementBytes;
+};
+struct MappedRange
+{
+	std::uint64_t pointer;
+	GLintptr offset;
+	GLsizeiptr length;
+	GLbitfield access;
+};
+
+// Read by every wrapper on every thread, including the ones that are not traced
+static std::atomic<bool> tracing{ false };
+static thread_local bool tracingThread{ false };
+static std::ofstream traceFile{};
+static std::vector<char> traceBuffer{};
+static std::int64_t traceStart{ 0 };
+static std::vector<bool> functionDefined{};
+static std::vector<PointerRule> pointerRules{};
+static std::vector<UniformShape> uniformShapes{};
+static std::unordered_map<GLuint, MappedRange> mappings{};
+static std::size_t blobCountOffset{ 0 };
+static std::uint8_t blobCount{ 0 };
+static long long recordedCalls{ 0 };
+static long long recordedFrames{ 0 };
+
+constexpr std::size_t TRACE_FLUSH_SIZE{ 1 << 20 };
+
+static std::int64_t traceNanoseconds()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() - traceStart;
+}
+static void flushTrace()
+{
+	traceFile.write(traceBuffer.data(), (std::streamsize)traceBuffer.size());
+	traceBuffer.clear();
+}
+static void writeBytes(const void* data, std::size_t size)
+{
+	const char* bytes{ (const char*)data };
+	traceBuffer.insert(traceBuffer.end(), bytes, bytes + size);
+}
+template<typename T>
+static void write(const T& value)
+{
+	writeBytes(&value, sizeof(T));
+}
+template<typename T>
+static void patch(std::size_t offset, const T& value)
+{
+	std::memcpy(traceBuffer.data() + offset, &value, sizeof(T));
+}
+// Pointers are stored as 8 bytes whatever the platform
+template<typename T>
+static void writeArgument(const T& value)
+{
+	if constexpr (std::is_pointer<T>::value)
+		write((std::uint64_t)(std::uintptr_t)value);
+	else
+		write(value);
+}
+template<typename T>
+static std::uint64_t rawArgument(const T& value)
+{
+	if constexpr (std::is_pointer<T>::value)
+		return (std::uint64_t)(std::uintptr_t)value;
+	else if constexpr (std::is_integral<T>::value)
+		return (std::uint64_t)(std::int64_t)value;
+	else
+		return 0;
+}
+// BLOBS
+// -----
+static void writeBlob(int argument, GLTraceBlob kind, const void* data, std::size_t size)
+{
+	write((std::uint8_t)argument);
+	write(kind);
+	write((std::uint32_t)size);
+	writeBytes(data, size);
+	++blobCount;
+}
+static void captureBytes(int argument, std::uint64_t pointer, std::int64_t size)
+{
+	if (pointer != 0 && size > 0)
+		writeBlob(argument, GLTraceBlob::Bytes, (const void*)(std::uintptr_t)pointer, (std::size_t)size);
+}
+static void captureString(int argument, std::uint64_t pointer)
+{
+	if (pointer != 0)
+		captureBytes(argument, pointer, (std::int64_t)std::strlen((const char*)(std::uintptr_t)pointer) + 1);
+}
+static void captureStringArray(int argument, std::uint64_t pointer, std::int64_t count, std::uint64_t lengthsPointer)
+{
+	if (pointer == 0 || count <= 0)
+		return;
+	const GLchar* const* strings{ (const GLchar* const*)(std::uintptr_t)pointer };
+	const GLint* lengths{ (const GLint*)(std::uintptr_t)lengthsPointer };
+	std::vector<char> packed{};
+	auto append{ [&packed](const void* data, std::size_t size) { packed.insert(packed.end(), (const char*)data, (const char*)data + size); } };
+	std::uint32_t stringCount{ (std::uint32_t)count };
+	append(&stringCount, sizeof(stringCount));
+	for (std::int64_t i{ 0 }; i < count; ++i)
+	{
+		std::uint32_t length{ (std::uint32_t)(lengths != nullptr && lengths[i] >= 0 ? lengths[i] : (GLint)std::strlen(strings[i])) };
+		append(&length, sizeof(length));
+		append(strings[i], length);
+	}
+	writeBlob(argument, GLTraceBlob::StringArray, packed.data(), packed.size());
+}
+static std::int64_t pixelBytes(std::uint64_t format, std::uint64_t type)
+{
+	std::int64_t components{ format == GL_RED || format == GL_RED_INTEGER || format == GL_DEPTH_COMPONENT || format == GL_STENCIL_INDEX ? 1
+		: format == GL_RG || format == GL_RG_INTEGER || format == GL_DEPTH_STENCIL ? 2
+		: format == GL_RGB || format == GL_BGR || format == GL_RGB_INTEGER ? 3 : 4 };
+	switch (type)
+	{
+	case GL_UNSIGNED_BYTE:
+	case GL_BYTE: return components;
+	case GL_UNSIGNED_SHORT:
+	case GL_SHORT:
+	case GL_HALF_FLOAT: return components * 2;
+	case GL_UNSIGNED_BYTE_3_3_2:
+	case GL_UNSIGNED_BYTE_2_3_3_REV: return 1;
+	case GL_UNSIGNED_SHORT_5_6_5:
+	case GL_UNSIGNED_SHORT_5_6_5_REV:
+	case GL_UNSIGNED_SHORT_4_4_4_4:
+	case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+	case GL_UNSIGNED_SHORT_5_5_5_1:
+	case GL_UNSIGNED_SHORT_1_5_5_5_REV: return 2;
+	case GL_FLOAT_32_UNSIGNED_INT_24_8_REV: return 8;
+	case GL_UNSIGNED_INT_24_8:
+	case GL_UNSIGNED_INT_10F_11F_11F_REV:
+	case GL_UNSIGNED_INT_5_9_9_9_REV:
+	case GL_UNSIGNED_INT_2_10_10_10_REV:
+	case GL_UNSIGNED_INT_10_10_10_2:
+	case GL_UNSIGNED_INT_8_8_8_8:
+	case GL_UNSIGNED_INT_8_8_8_8_REV: return 4;
+	default: return components * 4;
+	}
+}
+// Client memory only: with a pixel unpack buffer bound the pointer is an offset
+static void captureImage(int argument, std::uint64_t pointer, std::uint64_t width, std::uint64_t height, std::uint64_t depth, std::uint64_t format, std::uint64_t type)
+{
+	GLint unpackBuffer{ 0 };
+	GLint alignment{ 4 };
+	GLint rowLength{ 0 };
+	real_glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &unpackBuffer);
+	if (unpackBuffer != 0)
+		return;
+	real_glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+	real_glGetIntegerv(GL_UNPACK_ROW_LENGTH, &rowLength);
+	std::int64_t rowBytes{ (rowLength > 0 ? rowLength : (std::int64_t)width) * pixelBytes(format, type) };
+	rowBytes = (rowBytes + alignment - 1) / alignment * alignment;
+	captureBytes(argument, pointer, rowBytes * (std::int64_t)height * (std::int64_t)depth);
+}
+// MAPPED BUFFERS
+// --------------
+static GLenum bindingFor(GLenum target)
+{
+	switch (target)
+	{
+	case GL_ARRAY_BUFFER: return GL_ARRAY_BUFFER_BINDING;
+	case GL_ELEMENT_ARRAY_BUFFER: return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+	case GL_COPY_READ_BUFFER: return GL_COPY_READ_BUFFER_BINDING;
+	case GL_COPY_WRITE_BUFFER: return GL_COPY_WRITE_BUFFER_BINDING;
+	case GL_PIXEL_PACK_BUFFER: return GL_PIXEL_PACK_BUFFER_BINDING;
+	case GL_PIXEL_UNPACK_BUFFER: return GL_PIXEL_UNPACK_BUFFER_BINDING;
+	case GL_UNIFORM_BUFFER: return GL_UNIFORM_BUFFER_BINDING;
+	case GL_TEXTURE_BUFFER: return GL_TEXTURE_BUFFER_BINDING;
+	case GL_TRANSFORM_FEEDBACK_BUFFER: return GL_TRANSFORM_FEEDBACK_BUFFER_BINDING;
+	case GL_DRAW_INDIRECT_BUFFER: return GL_DRAW_INDIRECT_BUFFER_BINDING;
+	case GL_DISPATCH_INDIRECT_BUFFER: return GL_DISPATCH_INDIRECT_BUFFER_BINDING;
+	case GL_SHADER_STORAGE_BUFFER: return GL_SHADER_STORAGE_BUFFER_BINDING;
+	case GL_ATOMIC_COUNTER_BUFFER: return GL_ATOMIC_COUNTER_BUFFER_BINDING;
+	case GL_QUERY_BUFFER: return GL_QUERY_BUFFER_BINDING;
+	case GL_PARAMETER_BUFFER: return GL_PARAMETER_BUFFER_BINDING;
+	default: return GL_NONE;
+	}
+}
+static GLuint boundBuffer(std::uint64_t target)
+{
+	GLint buffer{ 0 };
+	GLenum binding{ bindingFor((GLenum)target) };
+	if (binding != GL_NONE)
+		real_glGetIntegerv(binding, &buffer);
+	return (GLuint)buffer;
+}
+static void writeMemory(const MappedRange& mapping, std::int64_t offset, std::int64_t size)
+{
+	// A flush outside the mapping is a GL error, there is nothing to copy
+	if (size <= 0 || offset < 0 || offset + size > (std::int64_t)mapping.length)
+		return;
+	write(GLTraceRecord::Memory);
+	write(mapping.pointer);
+	write((std::uint64_t)mapping.length);
+	write((std::uint64_t)offset);
+	write((std::uint32_t)size);
+	writeBytes((const char*)(std::uintptr_t)mapping.pointer + offset, (std::size_t)size);
+}
+// Before the call: what the application wrote into a mapping it now flushes or unmaps
+static void captureMappedWrites(std::uint16_t id, const std::uint64_t* raw)
+{
+	bool named{ id == TRACE_glFlushMappedNamedBufferRange || id == TRACE_glUnmapNamedBuffer };
+	bool flush{ id == TRACE_glFlushMappedBufferRange || id == TRACE_glFlushMappedNamedBufferRange };
+	if (!named && !flush && id != TRACE_glUnmapBuffer)
+		return;
+	GLuint buffer{ named ? (GLuint)raw[0] : boundBuffer(raw[0]) };
+	auto found{ mappings.find(buffer) };
+	if (found == mappings.end())
+		return;
+	const MappedRange& mapping{ found->second };
+	if (flush)
+		writeMemory(mapping, (std::int64_t)raw[1], (std::int64_t)raw[2]);
+	else
+	{
+		if ((mapping.access & GL_MAP_WRITE_BIT) != 0 && (mapping.access & GL_MAP_FLUSH_EXPLICIT_BIT) == 0)
+			writeMemory(mapping, 0, mapping.length);
+		mappings.erase(found);
+	}
+}
+static void trackMapping(std::uint16_t id, const std::uint64_t* raw, std::uint64_t result)
+{
+	if (result == 0)
+		return;
+	GLint size{ 0 };
+	switch (id)
+	{
+	case TRACE_glMapBuffer:
+		real_glGetBufferParameteriv((GLenum)raw[0], GL_BUFFER_SIZE, &size);
+		mappings[boundBuffer(raw[0])] = MappedRange{ result, 0, size, raw[1] == GL_READ_ONLY ? (GLbitfield)GL_MAP_READ_BIT : (GLbitfield)GL_MAP_WRITE_BIT };
+		break;
+	case TRACE_glMapBufferRange:
+		mappings[boundBuffer(raw[0])] = MappedRange{ result, (GLintptr)raw[1], (GLsizeiptr)raw[2], (GLbitfield)raw[3] };
+		break;
+	case TRACE_glMapNamedBuffer:
+		real_glGetNamedBufferParameteriv((GLuint)raw[0], GL_BUFFER_SIZE, &size);
+		mappings[(GLuint)raw[0]] = MappedRange{ result, 0, size, raw[1] == GL_READ_ONLY ? (GLbitfield)GL_MAP_READ_BIT : (GLbitfield)GL_MAP_WRITE_BIT };
+		break;
+	case TRACE_glMapNamedBufferRange:
+		mappings[(GLuint)raw[0]] = MappedRange{ result, (GLintptr)raw[1], (GLsizeiptr)raw[2], (GLbitfield)raw[3] };
+		break;
+	default:
+		break;
+	}
+}
+// POINTER CAPTURE
+// ---------------
+static void captureInputs(std::uint16_t id, const std::uint64_t* raw)
+{
+	switch (pointerRules[id])
+	{
+	case PointerRule::UniformArray:
+	{
+		const UniformShape& shape{ uniformShapes[id] };
+		captureBytes(shape.valueArgument, raw[shape.valueArgument], (std::int64_t)raw[shape.countArgument] * shape.elementBytes);
+		return;
+	}
+	case PointerRule::NameInput:
+		captureBytes(functionArity[id] - 1, raw[functionArity[id] - 1], (std::int64_t)raw[functionArity[id] - 2] * 4);
+		return;
+	case PointerRule::Special:
+		break;
+	default:
+		return;
+	}
+	switch (id)
+	{
+	case TRACE_glBufferData:
+	case TRACE_glNamedBufferData:
+	case TRACE_glBufferStorage:
+	case TRACE_glNamedBufferStorage:
+		captureBytes(2, raw[2], (std::int64_t)raw[1]);
+		break;
+	case TRACE_glBufferSubData:
+	case TRACE_glNamedBufferSubData:
+		captureBytes(3, raw[3], (std::int64_t)raw[2]);
+		break;
+	case TRACE_glClearBufferData:
+		captureBytes(4, raw[4], pixelBytes(raw[2], raw[3]));
+		break;
+	case TRACE_glClearBufferSubData:
+		captureBytes(6, raw[6], pixelBytes(raw[4], raw[5]));
+		break;
+	case TRACE_glTexImage2D:
+		captureImage(8, raw[8], raw[3], raw[4], 1, raw[6], raw[7]);
+		break;
+	case TRACE_glTexSubImage2D:
+	case TRACE_glTextureSubImage2D:
+		captureImage(8, raw[8], raw[4], raw[5], 1, raw[6], raw[7]);
+		break;
+	case TRACE_glTexImage3D:
+		captureImage(9, raw[9], raw[3], raw[4], raw[5], raw[7], raw[8]);
+		break;
+	case TRACE_glTexSubImage3D:
+	case TRACE_glTextureSubImage3D:
+		captureImage(10, raw[10], raw[5], raw[6], raw[7], raw[8], raw[9]);
+		break;
+	case TRACE_glShaderSource:
+		captureStringArray(2, raw[2], (std::int64_t)raw[1], raw[3]);
+		break;
+	case TRACE_glCreateShaderProgramv:
+	case TRACE_glTransformFeedbackVaryings:
+	case TRACE_glGetUniformIndices:
+		captureStringArray(2, raw[2], (std::int64_t)raw[1], 0);
+		break;
+	case TRACE_glGetUniformLocation:
+	case TRACE_glGetAttribLocation:
+	case TRACE_glGetUniformBlockIndex:
+	case TRACE_glGetFragDataLocation:
+		captureString(1, raw[1]);
+		break;
+	case TRACE_glBindAttribLocation:
+	case TRACE_glBindFragDataLocation:
+	case TRACE_glGetProgramResourceIndex:
+	case TRACE_glGetProgramResourceLocation:
+		captureString(2, raw[2]);
+		break;
+	case TRACE_glProgramBinary:
+		captureBytes(2, raw[2], (std::int64_t)raw[3]);
+		break;
+	case TRACE_glDebugMessageControl:
+		captureBytes(4, raw[4], (std::int64_t)raw[3] * 4);
+		break;
+	case TRACE_glDebugMessageInsert:
+		captureBytes(5, raw[5], (std::int64_t)(GLsizei)raw[4] >= 0 ? (std::int64_t)(GLsizei)raw[4] : (std::int64_t)std::strlen((const char*)(std::uintptr_t)raw[5]) + 1);
+		break;
+	case TRACE_glPushDebugGroup:
+		captureBytes(3, raw[3], (std::int64_t)(GLsizei)raw[2] >= 0 ? (std::int64_t)(GLsizei)raw[2] : (std::int64_t)std::strlen((const char*)(std::uintptr_t)raw[3]) + 1);
+		break;
+	case TRACE_glObjectLabel:
+		captureBytes(3, raw[3], (std::int64_t)(GLsizei)raw[2] >= 0 ? (std::int64_t)(GLsizei)raw[2] : (std::int64_t)std::strlen((const char*)(std::uintptr_t)raw[3]) + 1);
+		break;
+	case TRACE_glInvalidateSubFramebuffer:
+		captureBytes(2, raw[2], (std::int64_t)raw[1] * 4);
+		break;
+	case TRACE_glClearBufferfv:
+	case TRACE_glClearBufferiv:
+	case TRACE_glClearBufferuiv:
+		captureBytes(2, raw[2], raw[0] == GL_DEPTH || raw[0] == GL_STENCIL ? 4 : 16);
+		break;
+	case TRACE_glClearNamedFramebufferfv:
+	case TRACE_glClearNamedFramebufferiv:
+	case TRACE_glClearNamedFramebufferuiv:
+		captureBytes(3, raw[3], raw[1] == GL_DEPTH || raw[1] == GL_STENCIL ? 4 : 16);
+		break;
+	case TRACE_glTexParameterfv:
+	case TRACE_glTexParameteriv:
+	case TRACE_glTexParameterIiv:
+	case TRACE_glTexParameterIuiv:
+	case TRACE_glTextureParameterfv:
+	case TRACE_glTextureParameteriv:
+	case TRACE_glTextureParameterIiv:
+	case TRACE_glTextureParameterIuiv:
+	case TRACE_glSamplerParameterfv:
+	case TRACE_glSamplerParameteriv:
+	case TRACE_glSamplerParameterIiv:
+	case TRACE_glSamplerParameterIuiv:
+		captureBytes(2, raw[2], raw[1] == GL_TEXTURE_BORDER_COLOR || raw[1] == GL_TEXTURE_SWIZZLE_RGBA ? 16 : 4);
+		break;
+	default:
+		break;
+	}
+}
+static void captureOutputs(std::uint16_t id, const std::uint64_t* raw)
+{
+	if (pointerRules[id] != PointerRule::NameOutput)
+		return;
+	int last{ functionArity[id] - 1 };
+	std::int64_t count{ (std::int64_t)raw[last - 1] };
+	if (raw[last] != 0 && count > 0)
+		writeBlob(last, GLTraceBlob::Output, (const void*)(std::uintptr_t)raw[last], (std::size_t)count * 4);
+}
+static bool startsWith(const char* text, const char* prefix)
+{
+	return std::strncmp(text, prefix, std::strlen(prefix)) == 0;
+}
+// Uniform arrays follow a strict naming scheme: glUniform4fv, glProgramUniformMatrix3x4dv
+static bool parseUniformShape(const char* name, int arity, UniformShape& shape)
+{
+	bool program{ startsWith(name, "glProgramUniform") };
+	if (!program && !startsWith(name, "glUniform"))
+		return false;
+	std::string suffix{ name + (program ? 16 : 9) };
+	if (suffix.empty() || suffix.back() != 'v' || suffix.find("Handle") != std::string::npos)
+		return false;
+	suffix.pop_back();
+	int elementBytes{ 4 };
+	if (suffix.size() >= 2 && suffix.compare(suffix.size() - 2, 2, "ui") == 0)
+		suffix.resize(suffix.size() - 2);
+	else if (!suffix.empty() && (suffix.back() == 'f' || suffix.back() == 'i' || suffix.back() == 'd'))
+	{
+		elementBytes = suffix.back() == 'd' ? 8 : 4;
+		suffix.pop_back();
+	}
+	else
+		return false;
+	int components{ 0 };
+	if (startsWith(suffix.c_str(), "Matrix"))
+	{
+		std::string dimensions{ suffix.substr(6) };
+		if (dimensions.size() == 1)
+			components = (dimensions[0] - '0') * (dimensions[0] - '0');
+		else if (dimensions.size() == 3 && dimensions[1] == 'x')
+			components = (dimensions[0] - '0') * (dimensions[2] - '0');
+	}
+	else if (suffix.size() == 1 && suffix[0] >= '1' && suffix[0] <= '4')
+		components = suffix[0] - '0';
+	if (components == 0)
+		return false;
+	shape.countArgument = program ? 2 : 1;
+	shape.valueArgument = arity - 1;
+	shape.elementBytes = components * elementBytes;
+	return true;
+}
+static void buildPointerRules()
+{
+	pointerRules.assign(TRACE_FUNCTION_COUNT, PointerRule::None);
+	uniformShapes.assign(TRACE_FUNCTION_COUNT, UniformShape{});
+	for (int id{ 0 }; id < TRACE_FUNCTION_COUNT; ++id)
+	{
+		const char* name{ functionNames[id] };
+		int arity{ functionArity[id] };
+		bool namesArray{ functionLastIsPointer[id] && arity >= 2 && name[std::strlen(name) - 1] == 's' };
+		if (parseUniformShape(name, arity, uniformShapes[id]))
+			pointerRules[id] = PointerRule::UniformArray;
+		else if (namesArray && (startsWith(name, "glGen") || startsWith(name, "glCreate")))
+			pointerRules[id] = PointerRule::NameOutput;
+		else if (namesArray && (startsWith(name, "glDelete") || std::strcmp(name, "glDrawBuffers") == 0 || std::strcmp(name, "glNamedFramebufferDrawBuffers") == 0))
+			pointerRules[id] = PointerRule::NameInput;
+		else if (std::strcmp(name, "glInvalidateFramebuffer") == 0 || std::strcmp(name, "glInvalidateNamedFramebufferData") == 0)
+			pointerRules[id] = PointerRule::NameInput;
+		else
+			pointerRules[id] = PointerRule::Special;
+	}
+}
+// Buffered records go out once a call completes, never in the middle of one
+static void flushIfFull()
+{
+	if (traceBuffer.size() >= TRACE_FLUSH_SIZE)
+		flushTrace();
+}
+// WRAPPERS
+// --------
+template<typename F>
+struct TracedCall;
+template<typename R, typename... A>
+struct TracedCall<R(APIENTRY*)(A...)>
+{
+	using Function = R(APIENTRY*)(A...);
+	std::uint16_t id;
+	Function* real;
+	Function* slot;
+	Function wrapper;
+
+	R operator()(A... arguments) const
+	{
+		if (!tracingThread || !tracing.load(std::memory_order_relaxed))
+			return forward(arguments...);
+		if (!functionDefined[id])
+		{
+			functionDefined[id] = true;
+			write(GLTraceRecord::Function);
+			write(id);
+			write((std::uint8_t)std::strlen(functionNames[id]));
+			writeBytes(functionNames[id], std::strlen(functionNames[id]));
+		}
+		std::uint64_t raw[sizeof...(A) + 1]{ rawArgument(arguments)... };
+		captureMappedWrites(id, raw);
+
+		write(GLTraceRecord::Call);
+		write(id);
+		std::size_t timeOffset{ traceBuffer.size() };
+		write((std::uint64_t)0);
+		write((std::uint32_t)0);
+		(writeArgument(arguments), ...);
+		blobCountOffset = traceBuffer.size();
+		blobCount = 0;
+		write(blobCount);
+		captureInputs(id, raw);
+
+		std::int64_t start{ traceNanoseconds() };
+		if constexpr (std::is_void<R>::value)
+		{
+			forward(arguments...);
+			finish(raw, 0, start, timeOffset);
+			flushIfFull();
+		}
+		else
+		{
+			R result{ forward(arguments...) };
+			finish(raw, rawArgument(result), start, timeOffset);
+			writeArgument(result);
+			flushIfFull();
+			return result;
+		}
+	}
+	R forward(A... arguments) const
+	{
+		// A lazily bound entry point patches glad's pointer with the real one on
+		// its first call, take that over and put the wrapper back
+		if constexpr (std::is_void<R>::value)
+		{
+			(*real)(arguments...);
+			reclaim();
+		}
+		else
+		{
+			R result{ (*real)(arguments...) };
+			reclaim();
+			return result;
+		}
+	}
+	void reclaim() const
+	{
+		if (tracing.load(std::memory_order_relaxed) && *slot != wrapper)
+		{
+			*real = *slot;
+			*slot = wrapper;
+		}
+	}
+	void finish(const std::uint64_t* raw, std::uint64_t result, std::int64_t start, std::size_t timeOffset) const
+	{
+		std::int64_t end{ traceNanoseconds() };
+		captureOutputs(id, raw);
+		trackMapping(id, raw, result);
+		patch(blobCountOffset, blobCount);
+		patch(timeOffset, (std::uint64_t)start);
+		patch(timeOffset + 8, (std::uint32_t)std::min<std::int64_t>(end - start, 0xFFFFFFFF));
+		++recordedCalls;
+	}
+};
+
+#define GLAD_PROC(version, type, ret, name, params, args) \
+	static ret APIENTRY trace_gl##name params \
+	{ \
+		return TracedCall<type>{ TRACE_gl##name, &real_gl##name, &glad_gl##name, trace_gl##name } args; \
+	}
+#include <glad/glad_procs.h>
+#endif
+
+// BEGIN AND END
+// -------------
+static std::mutex sharingMutex{};
+static int sharedContexts{ 0 };
+
+bool GLTrace::begin(const std::string& path)
+{
+#ifdef ENGINE_GL_TRACE
+	if (tracing)
+		end();
+	std::lock_guard<std::mutex> lock{ sharingMutex };
+	if (sharedContexts > 0)
+	{
+		std::cout << "Not tracing GL calls to " << path << ": calls on the " << sharedContexts
+			<< " shared context(s) would be missing from the trace" << std::endl;
+		return false;
+	}
+	traceFile.open(path, std::ios::binary);
+	if (!traceFile)
+	{
+		std::cout << "Failed to open GL trace output " << path << std::endl;
+		return false;
+	}
+	buildPointerRules();
+	functionDefined.assign(TRACE_FUNCTION_COUNT, false);
+	mappings.clear();
+	traceBuffer.clear();
+	traceBuffer.reserve(TRACE_FLUSH_SIZE * 2);
+	recordedCalls = recordedFrames = 0;
+
+	GLint viewport[4]{ 0, 0, 0, 0 };
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	write(GL_TRACE_MAGIC);
+	write(GL_TRACE_VERSION);
+	write((std::uint32_t)viewport[2]);
+	write((std::uint32_t)viewport[3]);
+
+	// Entry points the context does not have stay NULL
+#define GLAD_PROC(version, type, ret, name, params, args) \
+	real_gl##name = glad_gl##name; \
+	if (glad_gl##name != NULL) \
+		glad_gl##name = trace_gl##name;
+#include <glad/glad_procs.h>
+	traceStart = 0;
+	traceStart = traceNanoseconds();
+	tracingThread = true;
+	tracing.store(true);
+	std::cout << "Tracing GL calls to " << path << std::endl;
+	return true;
+#else
+	std::cout << "GL tracing was not compiled in, configure with -DENGINE_GL_TRACE=ON to trace to " << path << std::endl;
+	return false;
+#endif
+}
+void GLTrace::end()
+{
+#ifdef ENGINE_GL_TRACE
+	std::lock_guard<std::mutex> lock{ sharingMutex };
+	if (!tracing)
+		return;
+	tracing.store(false);
+	tracingThread = false;
+#define GLAD_PROC(version, type, ret, name, params, args) \
+	if (glad_gl##name == trace_gl##name) \
+		glad_gl##name = real_gl##name;
+#include <glad/glad_procs.h>
+	flushTrace();
+	traceFile.close();
+	std::cout << "Traced " << recordedCalls << " GL calls over " << recordedFrames << " frames" << std::endl;
+#endif
+}
+bool GLTrace::active()
+{
+#ifdef ENGINE_GL_TRACE
+	return tracing;
+#else
+	return false;
+#endif
+}
+void GLTrace::markFrame()
+{
+#ifdef ENGINE_GL_TRACE
+	if (!tracingThread || !tracing.load(std::memory_order_relaxed))
+		return;
+	write(GLTraceRecord::Frame);
+	++recordedFrames;
+	flushIfFull();
+#endif
+}
+// SHARED CONTEXTS
+// ---------------
+bool GLTrace::addSharedContext()
+{
+	std::lock_guard<std::mutex> lock{ sharingMutex };
+	if (active())
+	{
+		std::cout << "Shared contexts are unavailable while tracing GL calls, their calls would be missing from the trace" << std::endl;
+		return false;
+	}
+	++sharedContexts;
+	return true;
+}
+void GLTrace::removeSharedContext()
+{
+	std::lock_guard<std::mutex> lock{ sharingMutex };
+	--sharedContexts;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+#include <string>
+
+// GL CALL TRACING
+// ---------------
+// Records every GL call made through glad, with its arguments, the data its
+// pointer arguments reference and how long it took, into a binary trace that
+// the Replay tool re-executes on a fresh headless context. Capture a scene
+// once, then benchmark or bisect it offline without the application.
+//
+// Tracing swaps every glad_gl* pointer for a recording wrapper, so it only
+// exists in builds configured with -DENGINE_GL_TRACE=ON; without it begin()
+// reports that and the pointers are never touched. Start right after the
+// context is created: replay starts from a fresh context too, so objects get
+// the same names and nothing recorded refers to state from before the trace.
+// Only calls from the thread that called begin() are recorded, so tracing
+// and shared contexts exclude each other: begin() refuses while a shared
+// context exists and Context::createShared() refuses while tracing. Objects
+// created on a shared context would otherwise be missing from the trace and
+// replay would refer to names it never created.
+//
+// Pointer arguments are captured where their size is known from the other
+// arguments (buffer and texture uploads, shader sources, uniform arrays,
+// name lists, strings). Core profile draw and attribute pointers are buffer
+// offsets and replay as such, glGet* outputs replay into scratch memory.
+// Writes into mapped buffers are captured at glFlushMappedBufferRange and
+// glUnmap*, persistent coherent mappings are not.
+class GLTrace
+{
+public:
+	static bool begin(const std::string& path);
+	static void end();
+	static bool active();
+	static void markFrame(); // Context::swapBuffers() calls this, replay reports per frame
+
+	// Called by Context around the lifetime of a shared context. addSharedContext()
+	// returns false, and counts nothing, while tracing.
+	static bool addSharedContext();
+	static void removeSharedContext();
+};
+
+// TRACE FORMAT
+// ------------
+// Header: GL_TRACE_MAGIC, GL_TRACE_VERSION, viewport width and height at
+// begin() (uint32 each), replay creates a context of that size. Then records, each
+// starting with a GLTraceRecord byte:
+//   Function  uint16 id, uint8 length, name; ids are assigned on first use
+//   Call      uint16 id, uint64 start ns, uint32 duration ns, every argument
+//             in its native size (pointers as 8 bytes), uint8 blob count and
+//             per blob uint8 argument, uint8 GLTraceBlob kind, uint32 size,
+//             bytes; then the return value in its native size
+//   Frame     nothing, marks a swap
+//   Memory    uint64 mapped pointer as returned to the application, uint64
+//             length of the mapping, uint64 offset into the mapping, uint32
+//             size, bytes; offset + size never exceeds the length
+// Everything is little-endian, the trace is only replayable on the same
+// architecture.
+constexpr std::uint32_t GL_TRACE_MAGIC{ 0x52544C47 }; // "GLTR"
+constexpr std::uint32_t GL_TRACE_VERSION{ 2 };
+
+enum class GLTraceRecord : std::uint8_t
+{
+	Function,
+	Call,
+	Frame,
+	Memory
+};
+
+enum class GLTraceBlob : std::uint8_t
+{
+	Bytes,       // the pointer points at these bytes
+	StringArray, // const GLchar* const*: uint32 count, then uint32 length and characters per string
+	Output       // what the call wrote (generated names), checked on replay
+};
@@ -0,0 +1,209 @@
+#include "GpuTimer.h"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+// Re-sample the GPU clock against the CPU one this often, both drift a little
+constexpr long long CALIBRATION_INTERVAL{ 120 };
+
+GpuTimer::~GpuTimer()
+{
+	destroy();
+}
+bool GpuTimer::create(int framesInFlight, int maxZonesPerFrame)
+{
+	destroy();
+	GLint major{ 0 };
+	GLint minor{ 0 };
+	glGetIntegerv(GL_MAJOR_VERSION, &major);
+	glGetIntegerv(GL_MINOR_VERSION, &minor);
+	if (major * 10 + minor < 33 && !gladHasExtension("GL_ARB_timer_query"))
+	{
+		std::cout << "GPU timer queries are not supported by this context" << std::endl;
+		return false;
+	}
+	GLint counterBits{ 0 };
+	glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counterBits);
+	if (counterBits == 0)
+	{
+		std::cout << "GPU timer queries are not supported by this context" << std::endl;
+		return false;
+	}
+
+	m_maxZones = maxZonesPerFrame;
+	m_frames.resize(framesInFlight);
+	for (Frame& frame : m_frames)
+	{
+		frame.queries.resize((std::size_t)maxZonesPerFrame * 2);
+		glGenQueries((GLsizei)frame.queries.size(), frame.queries.data());
+		frame.zones.reserve(maxZonesPerFrame);
+	}
+	m_results.resize((std::size_t)maxZonesPerFrame * 2);
+	return true;
+}
+void GpuTimer::destroy()
+{
+	for (Frame& frame : m_frames)
+		glDeleteQueries((GLsizei)frame.queries.size(), frame.queries.data());
+	m_frames.clear();
+	m_stack.clear();
+	m_lastFrame.clear();
+	m_inFrame = false;
+	Profiler::removeTrack(m_track);
+	m_track = nullptr;
+}
+// FRAME BRACKETS
+// --------------
+void GpuTimer::beginFrame()
+{
+	if (m_frames.empty())
+		return;
+	// Read back every finished frame, oldest first, without waiting on any
+	int count{ (int)m_frames.size() };
+	for (long long number{ std::max(m_frameNumber - count, 0LL) }; number < m_frameNumber; ++number)
+	{
+		Frame& frame{ m_frames[number % count] };
+		if (frame.pending && !collect(frame))
+			break;
+	}
+	Frame& frame{ m_frames[m_frameNumber % count] };
+	if (frame.pending && !collect(frame))
+	{
+		// The GPU is more than framesInFlight frames behind, reuse the slot anyway
+		++m_dropped;
+		frame.pending = false;
+	}
+	frame.zones.clear();
+	frame.usedQueries = 0;
+	frame.number = m_frameNumber;
+	m_stack.clear();
+	m_inFrame = true;
+}
+void GpuTimer::endFrame()
+{
+	if (!m_inFrame)
+		return;
+	while (!m_stack.empty())
+		end();
+	Frame& frame{ m_frames[m_frameNumber % m_frames.size()] };
+	frame.pending = frame.usedQueries > 0;
+	m_inFrame = false;
+	++m_frameNumber;
+}
+// ZONES
+// -----
+// Zones past maxZonesPerFrame are ignored, the stack keeps begin/end paired.
+void GpuTimer::begin(const char* name)
+{
+	if (!m_inFrame)
+		return;
+	Frame& frame{ m_frames[m_frameNumber % m_frames.size()] };
+	if ((int)frame.zones.size() >= m_maxZones)
+	{
+		m_stack.push_back(-1);
+		return;
+	}
+	int query{ frame.usedQueries++ };
+	glQueryCounter(frame.queries[query], GL_TIMESTAMP);
+	m_stack.push_back((int)frame.zones.size());
+	frame.zones.push_back(Zone{ name, (int)m_stack.size() - 1, query, -1 });
+}
+void GpuTimer::end()
+{
+	if (!m_inFrame || m_stack.empty())
+		return;
+	int zone{ m_stack.back() };
+	m_stack.pop_back();
+	if (zone < 0)
+		return;
+	Frame& frame{ m_frames[m_frameNumber % m_frames.size()] };
+	int query{ frame.usedQueries++ };
+	glQueryCounter(frame.queries[query], GL_TIMESTAMP);
+	frame.zones[zone].endQuery = query;
+}
+// READBACK
+// --------
+// Timestamps land in submission order, so once the frame's last query is
+// available all of them are and reading them cannot block.
+bool GpuTimer::collect(Frame& frame)
+{
+	GLuint available{ GL_FALSE };
+	glGetQueryObjectuiv(frame.queries[frame.usedQueries - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+	if (available == GL_FALSE)
+		return false;
+	for (int i{ 0 }; i < frame.usedQueries; ++i)
+		glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &m_results[i]);
+	frame.pending = false;
+
+	bool trace{ Profiler::enabled() };
+	if (trace)
+	{
+		if (m_track == nullptr)
+			m_track = Profiler::addTrack("GPU");
+		calibrate();
+	}
+	m_lastFrame.clear();
+	for (const Zone& zone : frame.zones)
+	{
+		GLuint64 begin{ m_results[zone.beginQuery] };
+		GLuint64 end{ m_results[zone.endQuery] };
+		double milliseconds{ end > begin ? (end - begin) / 1000000.0 : 0.0 };
+		m_lastFrame.push_back(GpuZoneTiming{ zone.name, zone.depth, milliseconds });
+
+		GpuPassStats* pass{ nullptr };
+		for (GpuPassStats& candidate : m_passes)
+		{
+			if (std::strcmp(candidate.name, zone.name) == 0)
+				pass = &candidate;
+		}
+		if (pass == nullptr)
+		{
+			m_passes.push_back(GpuPassStats{});
+			pass = &m_passes.back();
+			pass->name = zone.name;
+		}
+		pass->lastMilliseconds = milliseconds;
+		pass->totalMilliseconds += milliseconds;
+		pass->maxMilliseconds = std::max(pass->maxMilliseconds, milliseconds);
+		++pass->samples;
+
+		if (trace)
+		{
+			std::int64_t startTicks{ m_calibrationTicks + (std::int64_t)(((GLint64)begin - m_calibrationGpu) * m_ticksPerNanosecond) };
+			std::int64_t endTicks{ m_calibrationTicks + (std::int64_t)(((GLint64)end - m_calibrationGpu) * m_ticksPerNanosecond) };
+			Profiler::record(m_track, zone.name, startTicks, endTicks);
+		}
+	}
+	return true;
+}
+// GL_TIMESTAMP read through glGetInteger64v is the GPU clock "now" (when the
+// call reaches the GPU, not after it drains), pair it with the CPU clock
+void GpuTimer::calibrate()
+{
+	if (m_calibratedFrame >= 0 && m_frameNumber - m_calibratedFrame < CALIBRATION_INTERVAL)
+		return;
+	glGetInteger64v(GL_TIMESTAMP, &m_calibrationGpu);
+	m_calibrationTicks = Profiler::timestamp();
+	m_ticksPerNanosecond = Profiler::ticksPerNanosecond();
+	m_calibratedFrame = m_frameNumber;
+}
+// STATISTICS
+// ----------
+void GpuTimer::printStats() const
+{
+	if (m_passes.empty())
+		return;
+	std::cout << "GPU passes (avg/max/last ms over " << m_passes.front().samples << " frames, "
+		<< m_dropped << " dropped):" << std::endl;
+	std::ios_base::fmtflags flags{ std::cout.flags() };
+	std::streamsize precision{ std::cout.precision() };
+	std::cout << std::fixed << std::setprecision(3);
+	for (const GpuPassStats& pass : m_passes)
+	{
+		std::cout << "  " << std::left << std::setw(20) << pass.name << std::right << std::setw(9) << pass.averageMilliseconds()
+			<< std::setw(9) << pass.maxMilliseconds << std::setw(9) << pass.lastMilliseconds << std::endl;
+	}
+	std::cout.flags(flags);
+	std::cout.precision(precision);
+}
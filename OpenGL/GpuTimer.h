@@ -0,0 +1,128 @@
+#pragma once
+#include "Profiler.h"
+#include <glad/glad.h>
+#include <cstdint>
+#include <vector>
+
+// One zone of the newest frame whose queries have come back
+struct GpuZoneTiming
+{
+	const char* name;
+	int depth;
+	double milliseconds;
+};
+
+struct GpuPassStats
+{
+	const char* name{ nullptr };
+	double lastMilliseconds{ 0.0 };
+	double totalMilliseconds{ 0.0 };
+	double maxMilliseconds{ 0.0 };
+	long long samples{ 0 };
+
+	double averageMilliseconds() const { return samples > 0 ? totalMilliseconds / samples : 0.0; }
+};
+
+// GPU TIMER
+// ---------
+// Per pass GPU time from GL_TIMESTAMP queries (glQueryCounter, core since 3.3).
+// Every frame writes its timestamps into its own slot of a query pool that is
+// framesInFlight frames deep, and beginFrame() only reads back slots whose
+// last query reports GL_QUERY_RESULT_AVAILABLE, so the CPU never waits on the
+// GPU: results show up a few frames late instead. A slot that is still busy
+// when its turn comes around again is dropped and counted.
+// When the CPU profiler is enabled the zones are also recorded on a "GPU"
+// track of the Chrome trace, lined up with the CPU zones by sampling
+// GL_TIMESTAMP against Profiler::timestamp() every so often.
+//
+//   timer.beginFrame();
+//   {
+//       GPU_PROFILE_SCOPE(timer, "Shadows");
+//       ...
+//   }
+//   timer.endFrame();
+//
+// Zone names must outlive the timer, use string literals.
+class GpuTimer
+{
+public:
+	GpuTimer() = default;
+	~GpuTimer();
+	GpuTimer(const GpuTimer&) = delete;
+	GpuTimer& operator=(const GpuTimer&) = delete;
+
+	bool create(int framesInFlight = 4, int maxZonesPerFrame = 64);
+	void destroy();
+
+	void beginFrame();
+	void endFrame();
+	void begin(const char* name);
+	void end();
+
+	const std::vector<GpuZoneTiming>& lastFrame() const { return m_lastFrame; }
+	const std::vector<GpuPassStats>& passes() const { return m_passes; }
+	long long droppedFrames() const { return m_dropped; }
+	void printStats() const;
+
+private:
+	struct Zone
+	{
+		const char* name;
+		int depth;
+		int beginQuery;
+		int endQuery;
+	};
+	struct Frame
+	{
+		std::vector<GLuint> queries{};
+		std::vector<Zone> zones{};
+		int usedQueries{ 0 };
+		long long number{ 0 };
+		bool pending{ false };
+	};
+
+	bool collect(Frame& frame);
+	void calibrate();
+
+	std::vector<Frame> m_frames{};
+	std::vector<int> m_stack{};
+	std::vector<GpuZoneTiming> m_lastFrame{};
+	std::vector<GpuPassStats> m_passes{};
+	std::vector<GLuint64> m_results{};
+	int m_maxZones{ 0 };
+	long long m_frameNumber{ 0 };
+	long long m_dropped{ 0 };
+	bool m_inFrame{ false };
+
+	// GPU nanoseconds to Profiler ticks
+	ProfileThread* m_track{ nullptr };
+	GLint64 m_calibrationGpu{ 0 };
+	std::int64_t m_calibrationTicks{ 0 };
+	double m_ticksPerNanosecond{ 1.0 };
+	long long m_calibratedFrame{ -1 };
+};
+
+class GpuScope
+{
+public:
+	GpuScope(GpuTimer& timer, const char* name)
+		: m_timer{ timer }
+	{
+		m_timer.begin(name);
+	}
+	~GpuScope()
+	{
+		m_timer.end();
+	}
+	GpuScope(const GpuScope&) = delete;
+	GpuScope& operator=(const GpuScope&) = delete;
+
+private:
+	GpuTimer& m_timer;
+};
+
+#ifdef ENGINE_NO_PROFILER
+#define GPU_PROFILE_SCOPE(timer, name)
+#else
+#define GPU_PROFILE_SCOPE(timer, name) GpuScope PROFILE_CONCATENATE(gpuScope, __LINE__){ timer, name }
+#endif
@@ -0,0 +1,88 @@
+#include "InstanceBuffer.h"
+#include "FrameStats.h"
+#include "RenderState.h"
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+
+InstanceBuffer::~InstanceBuffer()
+{
+	destroy();
+}
+bool InstanceBuffer::create(int capacity)
+{
+	destroy();
+	glGenBuffers(1, &m_buffer);
+	if (m_buffer == 0)
+	{
+		std::cout << "Instance buffer failed to create" << std::endl;
+		return false;
+	}
+	// Storage is allocated by the first upload(), which binds through the state cache
+	m_capacity = capacity > 0 ? capacity : 1;
+	m_instances.reserve(m_capacity);
+	return true;
+}
+void InstanceBuffer::destroy()
+{
+	if (m_buffer != 0)
+		glDeleteBuffers(1, &m_buffer);
+	m_buffer = 0;
+	m_capacity = 0;
+	m_uploaded = 0;
+	m_instances.clear();
+}
+// ATTRIBUTES
+// ----------
+void attachInstanceAttributes(RenderStateCache& state, unsigned int vertexArray, unsigned int buffer, unsigned int firstLocation)
+{
+	state.bindVertexArray(vertexArray);
+	state.bindBuffer(GL_ARRAY_BUFFER, buffer);
+	glVertexAttribPointer(firstLocation, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)offsetof(InstanceData, offset));
+	glEnableVertexAttribArray(firstLocation);
+	glVertexAttribDivisor(firstLocation, 1);
+	glVertexAttribPointer(firstLocation + 1, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)offsetof(InstanceData, color));
+	glEnableVertexAttribArray(firstLocation + 1);
+	glVertexAttribDivisor(firstLocation + 1, 1);
+}
+void InstanceBuffer::attach(RenderStateCache& state, unsigned int vertexArray, unsigned int firstLocation) const
+{
+	attachInstanceAttributes(state, vertexArray, m_buffer, firstLocation);
+}
+// STREAMING
+// ---------
+void InstanceBuffer::upload(RenderStateCache& state)
+{
+	int count{ (int)m_instances.size() };
+	if (m_buffer == 0)
+	{
+		std::cout << "Instance buffer: upload() before create()" << std::endl;
+		m_uploaded = 0;
+		return;
+	}
+	state.bindBuffer(GL_ARRAY_BUFFER, m_buffer);
+	if (count > m_capacity)
+		m_capacity = std::max(m_capacity * 2, count);
+	// Orphan, then fill: the attribute pointers follow the buffer name, not the storage
+	glBufferData(GL_ARRAY_BUFFER, m_capacity * sizeof(InstanceData), NULL, GL_STREAM_DRAW);
+	if (count > 0)
+		glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(InstanceData), m_instances.data());
+	countUpload(count * sizeof(InstanceData));
+	m_uploaded = count;
+}
+// DRAWING
+// -------
+void InstanceBuffer::drawArrays(GLenum mode, int first, int count) const
+{
+	if (m_uploaded == 0)
+		return;
+	countDraw(mode, count, m_uploaded);
+	glDrawArraysInstanced(mode, first, count, m_uploaded);
+}
+void InstanceBuffer::drawElements(GLenum mode, int count, GLenum indexType, const void* indices) const
+{
+	if (m_uploaded == 0)
+		return;
+	countDraw(mode, count, m_uploaded);
+	glDrawElementsInstanced(mode, count, indexType, indices, m_uploaded);
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+
+class RenderStateCache;
+
+// INSTANCE DATA
+// -------------
+// Per-instance attributes, read by the vertex shader as two vec4s:
+//   location n     vec4(offset.x, offset.y, scale, rotation in radians)
+//   location n + 1 vec4(color)
+struct InstanceData
+{
+	float offset[2]{ 0.0f, 0.0f };
+	float scale{ 1.0f };
+	float rotation{ 0.0f };
+	float color[4]{ 1.0f, 1.0f, 1.0f, 1.0f };
+};
+
+// Point attributes firstLocation and firstLocation + 1 of vertexArray at
+// InstanceData records in buffer, advancing once per instance. Binds both
+// through state, so they stay bound afterwards.
+void attachInstanceAttributes(RenderStateCache& state, unsigned int vertexArray, unsigned int buffer, unsigned int firstLocation);
+
+// INSTANCE BUFFER
+// ---------------
+// Streams a frame's worth of InstanceData into a GL buffer that is attached to
+// a mesh's vertex array with glVertexAttribDivisor(1), so one instanced draw
+// replaces a draw call per copy. Each upload() orphans the previous storage
+// (glBufferData with NULL) so the driver never has to wait for the GPU to
+// finish reading last frame's instances before the new ones are written.
+class InstanceBuffer
+{
+public:
+	~InstanceBuffer();
+	InstanceBuffer() = default;
+	InstanceBuffer(const InstanceBuffer&) = delete;
+	InstanceBuffer& operator=(const InstanceBuffer&) = delete;
+
+	bool create(int capacity);
+	void destroy();
+	void attach(RenderStateCache& state, unsigned int vertexArray, unsigned int firstLocation) const; // uses firstLocation and firstLocation + 1
+
+	void clear() { m_instances.clear(); }
+	void push(const InstanceData& instance) { m_instances.push_back(instance); }
+	void upload(RenderStateCache& state); // grows the GL buffer when more instances were pushed than it can hold
+
+	// Draw every uploaded instance; the mesh's vertex array must be bound
+	void drawArrays(GLenum mode, int first, int count) const;
+	void drawElements(GLenum mode, int count, GLenum indexType, const void* indices) const;
+
+	int count() const { return m_uploaded; }
+	unsigned int buffer() const { return m_buffer; }
+
+private:
+	unsigned int m_buffer{ 0 };
+	int m_capacity{ 0 };
+	int m_uploaded{ 0 };
+	std::vector<InstanceData> m_instances{};
+};
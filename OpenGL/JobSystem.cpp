@@ -0,0 +1,259 @@
+#include "JobSystem.h"
+#include <algorithm>
+#include <iostream>
+#if defined(_M_X64) || defined(__x86_64__)
+#include <immintrin.h>
+#define JOB_PAUSE() _mm_pause()
+#else
+#define JOB_PAUSE() std::this_thread::yield()
+#endif
+
+// Spin this many failed rounds before an idle worker sleeps
+constexpr int IDLE_SPINS{ 64 };
+
+static thread_local const JobSystem* currentSystem{ nullptr };
+static thread_local int currentIndex{ -1 };
+
+// WORK-STEALING DEQUE
+// -------------------
+bool JobDeque::push(Job* job)
+{
+	std::int64_t bottom{ m_bottom.load(std::memory_order_relaxed) };
+	std::int64_t top{ m_top.load(std::memory_order_acquire) };
+	if (bottom - top >= CAPACITY)
+		return false;
+	m_jobs[bottom & (CAPACITY - 1)].store(job, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	m_bottom.store(bottom + 1, std::memory_order_relaxed);
+	return true;
+}
+Job* JobDeque::pop()
+{
+	std::int64_t bottom{ m_bottom.load(std::memory_order_relaxed) - 1 };
+	m_bottom.store(bottom, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	std::int64_t top{ m_top.load(std::memory_order_relaxed) };
+	if (top > bottom)
+	{
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+		return nullptr;
+	}
+	Job* job{ m_jobs[bottom & (CAPACITY - 1)].load(std::memory_order_relaxed) };
+	if (top == bottom)
+	{
+		// Last job: race the thieves for it
+		if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			job = nullptr;
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+	}
+	return job;
+}
+Job* JobDeque::steal()
+{
+	std::int64_t top{ m_top.load(std::memory_order_acquire) };
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	std::int64_t bottom{ m_bottom.load(std::memory_order_acquire) };
+	if (top >= bottom)
+		return nullptr;
+	Job* job{ m_jobs[top & (CAPACITY - 1)].load(std::memory_order_relaxed) };
+	if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		return nullptr;
+	return job;
+}
+bool JobDeque::empty() const
+{
+	return m_bottom.load(std::memory_order_relaxed) <= m_top.load(std::memory_order_relaxed);
+}
+// CREATE
+// ------
+JobSystem::~JobSystem()
+{
+	destroy();
+}
+bool JobSystem::create(int workerThreads)
+{
+	destroy();
+	if (workerThreads < 0)
+		workerThreads = std::max((int)std::thread::hardware_concurrency() - 1, 0);
+	for (int i{ 0 }; i <= workerThreads; ++i)
+	{
+		std::unique_ptr<Worker> worker{ std::make_unique<Worker>() };
+		worker->pool = std::make_unique<Job[]>(JOB_POOL_SIZE);
+		worker->random = 0x9E3779B9u * (i + 1);
+		m_workers.push_back(std::move(worker));
+	}
+	currentSystem = this;
+	currentIndex = 0;
+	m_running.store(true);
+	for (int i{ 1 }; i <= workerThreads; ++i)
+		m_threads.emplace_back(&JobSystem::workerLoop, this, i);
+	return true;
+}
+void JobSystem::destroy()
+{
+	if (m_workers.empty())
+		return;
+	{
+		std::lock_guard<std::mutex> lock{ m_sleepMutex };
+		m_running.store(false);
+	}
+	m_wake.notify_all();
+	for (std::thread& thread : m_threads)
+		thread.join();
+	m_threads.clear();
+	m_workers.clear();
+	if (currentSystem == this)
+	{
+		currentSystem = nullptr;
+		currentIndex = -1;
+	}
+}
+int JobSystem::currentWorker() const
+{
+	return currentSystem == this ? currentIndex : -1;
+}
+// SUBMISSION
+// ----------
+Job* JobSystem::allocate(JobCounter& counter)
+{
+	// Slots free up out of order (a queued job can outlive thousands of later
+	// ones), so look for the next one not in flight
+	Worker& worker{ *m_workers[currentIndex] };
+	for (int i{ 0 }; i < JOB_POOL_SIZE; ++i)
+	{
+		Job* job{ &worker.pool[worker.nextJob++ & (JOB_POOL_SIZE - 1)] };
+		if (job->busy.load(std::memory_order_acquire))
+			continue;
+		job->busy.store(true, std::memory_order_relaxed);
+		job->counter = &counter;
+		counter.pending.fetch_add(1, std::memory_order_relaxed);
+		return job;
+	}
+	worker.inlineExecutions.store(worker.inlineExecutions.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	return nullptr;
+}
+void JobSystem::submit(Job* job)
+{
+	Worker& worker{ *m_workers[currentIndex] };
+	if (!worker.deque.push(job))
+	{
+		worker.inlineExecutions.store(worker.inlineExecutions.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		execute(job);
+		return;
+	}
+	m_queued.fetch_add(1);
+	// The sleeper re-checks m_queued under the mutex, so no wake-up gets lost
+	if (m_sleeping.load() > 0)
+	{
+		std::lock_guard<std::mutex> lock{ m_sleepMutex };
+		m_wake.notify_one();
+	}
+}
+// EXECUTION
+// ---------
+void JobSystem::execute(Job* job)
+{
+	JobCounter* counter{ job->counter };
+	job->invoke(*job);
+	Worker& worker{ *m_workers[currentIndex] };
+	worker.executed.store(worker.executed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	job->busy.store(false, std::memory_order_release);
+	counter->pending.fetch_sub(1, std::memory_order_release);
+}
+bool JobSystem::runOne(int self)
+{
+	Worker& worker{ *m_workers[self] };
+	Job* job{ worker.deque.pop() };
+	if (job == nullptr)
+	{
+		// xorshift, a different victim order per attempt spreads the thieves out
+		worker.random ^= worker.random << 13;
+		worker.random ^= worker.random >> 17;
+		worker.random ^= worker.random << 5;
+		int count{ (int)m_workers.size() };
+		int start{ (int)(worker.random % (std::uint32_t)count) };
+		for (int i{ 0 }; i < count && job == nullptr; ++i)
+		{
+			int victim{ (start + i) % count };
+			if (victim == self)
+				continue;
+			if (m_workers[victim]->deque.empty())
+				continue;
+			job = m_workers[victim]->deque.steal();
+			if (job != nullptr)
+				worker.steals.store(worker.steals.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			else
+				worker.failedSteals.store(worker.failedSteals.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		}
+		if (job == nullptr)
+			return false;
+	}
+	m_queued.fetch_sub(1, std::memory_order_relaxed);
+	execute(job);
+	return true;
+}
+void JobSystem::wait(JobCounter& counter)
+{
+	// The jobs left may be running on a thread that is not scheduled right now,
+	// so yield rather than spin when there is nothing to help with
+	int self{ currentWorker() };
+	while (!counter.done())
+	{
+		if (self < 0 || !runOne(self))
+			std::this_thread::yield();
+	}
+}
+void JobSystem::workerLoop(int index)
+{
+	currentSystem = this;
+	currentIndex = index;
+	Worker& worker{ *m_workers[index] };
+	int idle{ 0 };
+	while (m_running.load(std::memory_order_relaxed))
+	{
+		if (runOne(index))
+		{
+			idle = 0;
+			continue;
+		}
+		if (++idle < IDLE_SPINS)
+		{
+			JOB_PAUSE();
+			continue;
+		}
+		idle = 0;
+		std::unique_lock<std::mutex> lock{ m_sleepMutex };
+		m_sleeping.fetch_add(1);
+		worker.sleeps.store(worker.sleeps.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		m_wake.wait(lock, [this] { return m_queued.load() > 0 || !m_running.load(); });
+		m_sleeping.fetch_sub(1);
+	}
+	currentSystem = nullptr;
+	currentIndex = -1;
+}
+// STATISTICS
+// ----------
+JobSystemStats JobSystem::stats() const
+{
+	JobSystemStats total{};
+	for (const std::unique_ptr<Worker>& worker : m_workers)
+	{
+		total.executed += worker->executed.load(std::memory_order_relaxed);
+		total.steals += worker->steals.load(std::memory_order_relaxed);
+		total.failedSteals += worker->failedSteals.load(std::memory_order_relaxed);
+		total.inlineExecutions += worker->inlineExecutions.load(std::memory_order_relaxed);
+		total.sleeps += worker->sleeps.load(std::memory_order_relaxed);
+	}
+	return total;
+}
+void JobSystem::resetStats()
+{
+	for (const std::unique_ptr<Worker>& worker : m_workers)
+	{
+		worker->executed.store(0, std::memory_order_relaxed);
+		worker->steals.store(0, std::memory_order_relaxed);
+		worker->failedSteals.store(0, std::memory_order_relaxed);
+		worker->inlineExecutions.store(0, std::memory_order_relaxed);
+		worker->sleeps.store(0, std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,220 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// JOB
+// ---
+// A callable stored inline (no allocation per job) plus the counter to
+// decrement when it finishes. Captures must fit JOB_STORAGE bytes, which keeps
+// a job on one cache line.
+constexpr std::size_t JOB_STORAGE{ 40 };
+
+struct JobCounter
+{
+	std::atomic<int> pending{ 0 };
+
+	bool done() const { return pending.load(std::memory_order_acquire) == 0; }
+};
+
+struct alignas(64) Job
+{
+	void (*invoke)(Job& job){ nullptr };
+	JobCounter* counter{ nullptr };
+	std::atomic<bool> busy{ false }; // set from allocation until the job finished
+	alignas(8) unsigned char storage[JOB_STORAGE];
+};
+
+// WORK-STEALING DEQUE
+// -------------------
+// Chase-Lev deque with the memory orderings from Le, Pop, Cohen and Zappa
+// Nardelli, "Correct and Efficient Work-Stealing for Weak Memory Models"
+// (PPoPP 2013). The owning thread pushes and pops at the bottom, LIFO, so it
+// keeps working on what is hot in its cache; other threads steal the oldest
+// job from the top. Fixed capacity: push() fails when full and the caller
+// runs the job itself.
+class JobDeque
+{
+public:
+	static constexpr std::int64_t CAPACITY{ 4096 };
+
+	bool push(Job* job);
+	Job* pop();
+	Job* steal();
+	bool empty() const;
+
+private:
+	alignas(64) std::atomic<std::int64_t> m_top{ 0 };
+	alignas(64) std::atomic<std::int64_t> m_bottom{ 0 };
+	alignas(64) std::atomic<Job*> m_jobs[CAPACITY]{};
+};
+
+struct JobSystemStats
+{
+	long long executed{ 0 };
+	long long steals{ 0 };          // jobs taken from another thread's deque
+	long long failedSteals{ 0 };    // steal attempts that lost the race for the victim's last job
+	long long inlineExecutions{ 0 }; // jobs run immediately, deque full or no free job slot
+	long long sleeps{ 0 };
+};
+
+// JOB SYSTEM
+// ----------
+// One worker thread per core besides the calling thread, which takes part as
+// worker 0 whenever it waits. Each worker owns a JobDeque and a pool of job
+// slots; idle workers steal from a random victim before going to sleep.
+// Dependencies are expressed with JobCounters: run() increments one,
+// finishing the job decrements it, and wait() keeps executing other jobs
+// until it reaches zero, so waiting never blocks a core and jobs can spawn and
+// wait on children (continuation style, no fibers).
+//
+//   JobCounter counter{};
+//   jobs.run(counter, [&] { animate(skeletons); });
+//   jobs.parallelFor(0, count, 256, [&](std::size_t begin, std::size_t end) { cull(begin, end); });
+//   jobs.wait(counter);
+//
+// The thread that called create() and the workers submit to their own deques;
+// any other thread runs what it submits inline, as does a thread that has
+// JOB_POOL_SIZE of its jobs in flight already.
+class JobSystem
+{
+public:
+	static constexpr int JOB_POOL_SIZE{ 4096 };
+
+	JobSystem() = default;
+	~JobSystem();
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	bool create(int workerThreads = -1); // -1: hardware threads - 1
+	void destroy();
+
+	template<typename F>
+	void run(JobCounter& counter, F&& function);
+	// Calls function(begin, end) on subranges of at most grain elements and
+	// returns when all are done. The range is split in halves lazily, so idle
+	// workers steal big pieces first.
+	template<typename F>
+	void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, F&& function);
+	void wait(JobCounter& counter);
+
+	int threadCount() const { return (int)m_workers.size(); }
+	JobSystemStats stats() const;
+	void resetStats();
+
+private:
+	struct alignas(64) Worker
+	{
+		JobDeque deque{};
+		std::unique_ptr<Job[]> pool{};
+		std::uint32_t nextJob{ 0 };
+		std::uint32_t random{ 0 };
+		std::atomic<long long> executed{ 0 };
+		std::atomic<long long> steals{ 0 };
+		std::atomic<long long> failedSteals{ 0 };
+		std::atomic<long long> inlineExecutions{ 0 };
+		std::atomic<long long> sleeps{ 0 };
+	};
+
+	template<typename F>
+	struct RangeTask
+	{
+		JobSystem* system;
+		F* function;
+		std::size_t begin;
+		std::size_t end;
+		std::size_t grain;
+	};
+	template<typename F>
+	static void splitRange(Job& job);
+
+	Job* allocate(JobCounter& counter); // nullptr when every slot is busy
+	void submit(Job* job);
+	void execute(Job* job);
+	bool runOne(int self);
+	void workerLoop(int index);
+	int currentWorker() const;
+
+	std::vector<std::unique_ptr<Worker>> m_workers{};
+	std::vector<std::thread> m_threads{};
+	std::atomic<bool> m_running{ false };
+	std::atomic<int> m_queued{ 0 };
+	std::atomic<int> m_sleeping{ 0 };
+	std::mutex m_sleepMutex{};
+	std::condition_variable m_wake{};
+};
+
+// TEMPLATE IMPLEMENTATION
+// -----------------------
+template<typename F>
+void JobSystem::run(JobCounter& counter, F&& function)
+{
+	using Function = typename std::decay<F>::type;
+	static_assert(sizeof(Function) <= JOB_STORAGE, "Job captures must fit JOB_STORAGE bytes, capture by reference or pointer");
+	static_assert(alignof(Function) <= 8, "Job captures are over-aligned");
+	Job* job{ currentWorker() >= 0 ? allocate(counter) : nullptr };
+	if (job == nullptr)
+	{
+		function();
+		return;
+	}
+	new (job->storage) Function{ std::forward<F>(function) };
+	job->invoke = [](Job& self)
+	{
+		Function* stored{ std::launder((Function*)self.storage) };
+		(*stored)();
+		stored->~Function();
+	};
+	submit(job);
+}
+template<typename F>
+void JobSystem::splitRange(Job& job)
+{
+	RangeTask<F> task{ *std::launder((RangeTask<F>*)job.storage) };
+	// Hand the upper halves to the deque, keep splitting the lower one
+	while (task.end - task.begin > task.grain)
+	{
+		std::size_t middle{ task.begin + (task.end - task.begin) / 2 };
+		Job* half{ task.system->allocate(*job.counter) };
+		if (half == nullptr)
+			break;
+		new (half->storage) RangeTask<F>{ task.system, task.function, middle, task.end, task.grain };
+		half->invoke = &splitRange<F>;
+		task.system->submit(half);
+		task.end = middle;
+	}
+	(*task.function)(task.begin, task.end);
+}
+template<typename F>
+void JobSystem::parallelFor(std::size_t begin, std::size_t end, std::size_t grain, F&& function)
+{
+	if (begin >= end)
+		return;
+	if (currentWorker() < 0)
+	{
+		function(begin, end);
+		return;
+	}
+	using Function = typename std::remove_reference<F>::type;
+	static_assert(sizeof(RangeTask<Function>) <= JOB_STORAGE, "RangeTask must fit a job");
+	// The callable stays on this stack frame, every range points at it
+	JobCounter counter{};
+	Job* job{ allocate(counter) };
+	if (job == nullptr)
+	{
+		function(begin, end);
+		return;
+	}
+	new (job->storage) RangeTask<Function>{ this, &function, begin, end, grain > 0 ? grain : 1 };
+	job->invoke = &splitRange<Function>;
+	submit(job);
+	wait(counter);
+}
@@ -86,6 +86,17 @@ GLAPI int gladLoadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+/* Lazy binding: every glad_gl* pointer starts out as a trampoline that
+ * resolves the real entry point through the loader on its first call.
+ * The loader must stay valid (and the context current) while unresolved
+ * functions can still be called. */
+GLAPI int gladLoadGLLoaderLazy(GLADloadproc);
+
+/* Constant time extension query against the set captured by the last load,
+ * e.g. gladHasExtension("GL_ARB_bindless_texture"). With a per-context table
+ * current on the calling thread, that context's set is queried instead. */
+GLAPI int gladHasExtension(const char *ext);
+
 #include <KHR/khrplatform.h>
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;
@@ -3687,6 +3698,48 @@ GLAPI PFNGLPOLYGONOFFSETCLAMPPROC glad_glPolygonOffsetClamp;
 #define glPolygonOffsetClamp glad_glPolygonOffsetClamp
 #endif
 
+/* PER-CONTEXT DISPATCH
+ *
+ * A GladGLContext holds its own version, extension set and a pointer for
+ * every entry point, so several contexts (possibly from different drivers)
+ * can live in one process. Members are named after the functions, i.e.
+ * context->glDrawArrays(...). Loading is independent of the global pointers.
+ *
+ * gladUseContextDispatch() turns the global glad_gl* pointers into stubs that
+ * forward to the table made current on the calling thread with
+ * gladMakeContextCurrent(), so ordinary glDrawArrays(...) calls follow the
+ * thread's context. Make the table current before enabling dispatch: entries
+ * it doesn't have stay NULL, and GLVersion and the GLAD_GL_VERSION_* flags
+ * take its version. Those are process wide, so every context that enables
+ * dispatch must have the same version: a lower one lowers them for all
+ * threads, a higher one leaves them alone. A context's own version is in
+ * its table's major and minor. Once enabled, every thread issuing GL calls needs a
+ * current table; a call without one, or after the table was freed on any
+ * thread, does nothing and returns 0. Making a table current does not make
+ * the window system context current, that is still the caller's job. */
+typedef struct gladExtensionSet {
+    void *block;
+    unsigned int *hashes;
+    const char **names;
+    unsigned int mask;
+    int count;
+} gladExtensionSet;
+
+typedef struct GladGLContext {
+    int major;
+    int minor;
+    gladExtensionSet extensions;
+#define GLAD_PROC(version, type, ret, name, params, args) type gl##name;
+#include <glad/glad_procs.h>
+} GladGLContext;
+
+GLAPI int gladLoadGLContext(GladGLContext *context, GLADloadproc load);
+GLAPI void gladFreeGLContext(GladGLContext *context);
+GLAPI int gladContextHasExtension(const GladGLContext *context, const char *ext);
+GLAPI void gladMakeContextCurrent(GladGLContext *context);
+GLAPI GladGLContext* gladGetCurrentContext(void);
+GLAPI void gladUseContextDispatch(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,731 @@
+/*
+
+    Entry point list for the glad loader in OpenGL/glad.c, one line per
+    function declared in glad.h (gl=4.6 core), in glad.h order.
+
+    This is an X-macro list: define GLAD_PROC (and optionally GLAD_PROC_VOID)
+    and include this file to expand something for every entry point.
+
+        GLAD_PROC(version, type, ret, name, params, args)
+        GLAD_PROC_VOID(version, type, name, params, args)
+
+    version  VERSION_X_Y section the function belongs to (GLAD_GL_##version)
+    type     function pointer typedef, e.g. PFNGLCULLFACEPROC
+    ret      return type (GLAD_PROC_VOID entries return void)
+    name     name without the gl prefix, the pointer is glad_gl##name
+    params   parenthesized parameter declarations
+    args     parenthesized parameter names, for forwarding calls
+
+    Both macros are undefined again at the end of the list. Regenerate
+    together with glad.h.
+*/
+
+#ifndef GLAD_PROC
+#error Define GLAD_PROC before including glad_procs.h
+#endif
+#ifndef GLAD_PROC_VOID
+#define GLAD_PROC_VOID(version, type, name, params, args) GLAD_PROC(version, type, void, name, params, args)
+#endif
+
+GLAD_PROC_VOID(VERSION_1_0, PFNGLCULLFACEPROC, CullFace, (GLenum mode), (mode))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLFRONTFACEPROC, FrontFace, (GLenum mode), (mode))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLHINTPROC, Hint, (GLenum target, GLenum mode), (target, mode))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLLINEWIDTHPROC, LineWidth, (GLfloat width), (width))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLPOINTSIZEPROC, PointSize, (GLfloat size), (size))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLPOLYGONMODEPROC, PolygonMode, (GLenum face, GLenum mode), (face, mode))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLSCISSORPROC, Scissor, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLTEXPARAMETERFPROC, TexParameterf, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLTEXPARAMETERFVPROC, TexParameterfv, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLTEXPARAMETERIPROC, TexParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLTEXPARAMETERIVPROC, TexParameteriv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLTEXIMAGE1DPROC, TexImage1D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, border, format, type, pixels))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLTEXIMAGE2DPROC, TexImage2D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLDRAWBUFFERPROC, DrawBuffer, (GLenum buf), (buf))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLCLEARPROC, Clear, (GLbitfield mask), (mask))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLCLEARCOLORPROC, ClearColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLCLEARSTENCILPROC, ClearStencil, (GLint s), (s))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLCLEARDEPTHPROC, ClearDepth, (GLdouble depth), (depth))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLSTENCILMASKPROC, StencilMask, (GLuint mask), (mask))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLCOLORMASKPROC, ColorMask, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLDEPTHMASKPROC, DepthMask, (GLboolean flag), (flag))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLDISABLEPROC, Disable, (GLenum cap), (cap))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLENABLEPROC, Enable, (GLenum cap), (cap))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLFINISHPROC, Finish, (void), ())
+GLAD_PROC_VOID(VERSION_1_0, PFNGLFLUSHPROC, Flush, (void), ())
+GLAD_PROC_VOID(VERSION_1_0, PFNGLBLENDFUNCPROC, BlendFunc, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLLOGICOPPROC, LogicOp, (GLenum opcode), (opcode))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLSTENCILFUNCPROC, StencilFunc, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLSTENCILOPPROC, StencilOp, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLDEPTHFUNCPROC, DepthFunc, (GLenum func), (func))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLPIXELSTOREFPROC, PixelStoref, (GLenum pname, GLfloat param), (pname, param))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLPIXELSTOREIPROC, PixelStorei, (GLenum pname, GLint param), (pname, param))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLREADBUFFERPROC, ReadBuffer, (GLenum src), (src))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLREADPIXELSPROC, ReadPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels), (x, y, width, height, format, type, pixels))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLGETBOOLEANVPROC, GetBooleanv, (GLenum pname, GLboolean *data), (pname, data))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLGETDOUBLEVPROC, GetDoublev, (GLenum pname, GLdouble *data), (pname, data))
+GLAD_PROC(VERSION_1_0, PFNGLGETERRORPROC, GLenum, GetError, (void), ())
+GLAD_PROC_VOID(VERSION_1_0, PFNGLGETFLOATVPROC, GetFloatv, (GLenum pname, GLfloat *data), (pname, data))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLGETINTEGERVPROC, GetIntegerv, (GLenum pname, GLint *data), (pname, data))
+GLAD_PROC(VERSION_1_0, PFNGLGETSTRINGPROC, const GLubyte *, GetString, (GLenum name), (name))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLGETTEXIMAGEPROC, GetTexImage, (GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (target, level, format, type, pixels))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLGETTEXPARAMETERFVPROC, GetTexParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLGETTEXPARAMETERIVPROC, GetTexParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLGETTEXLEVELPARAMETERFVPROC, GetTexLevelParameterfv, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLGETTEXLEVELPARAMETERIVPROC, GetTexLevelParameteriv, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params))
+GLAD_PROC(VERSION_1_0, PFNGLISENABLEDPROC, GLboolean, IsEnabled, (GLenum cap), (cap))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLDEPTHRANGEPROC, DepthRange, (GLdouble n, GLdouble f), (n, f))
+GLAD_PROC_VOID(VERSION_1_0, PFNGLVIEWPORTPROC, Viewport, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_PROC_VOID(VERSION_1_1, PFNGLDRAWARRAYSPROC, DrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GLAD_PROC_VOID(VERSION_1_1, PFNGLDRAWELEMENTSPROC, DrawElements, (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices))
+GLAD_PROC_VOID(VERSION_1_1, PFNGLPOLYGONOFFSETPROC, PolygonOffset, (GLfloat factor, GLfloat units), (factor, units))
+GLAD_PROC_VOID(VERSION_1_1, PFNGLCOPYTEXIMAGE1DPROC, CopyTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border))
+GLAD_PROC_VOID(VERSION_1_1, PFNGLCOPYTEXIMAGE2DPROC, CopyTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+GLAD_PROC_VOID(VERSION_1_1, PFNGLCOPYTEXSUBIMAGE1DPROC, CopyTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width))
+GLAD_PROC_VOID(VERSION_1_1, PFNGLCOPYTEXSUBIMAGE2DPROC, CopyTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height))
+GLAD_PROC_VOID(VERSION_1_1, PFNGLTEXSUBIMAGE1DPROC, TexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels))
+GLAD_PROC_VOID(VERSION_1_1, PFNGLTEXSUBIMAGE2DPROC, TexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_PROC_VOID(VERSION_1_1, PFNGLBINDTEXTUREPROC, BindTexture, (GLenum target, GLuint texture), (target, texture))
+GLAD_PROC_VOID(VERSION_1_1, PFNGLDELETETEXTURESPROC, DeleteTextures, (GLsizei n, const GLuint *textures), (n, textures))
+GLAD_PROC_VOID(VERSION_1_1, PFNGLGENTEXTURESPROC, GenTextures, (GLsizei n, GLuint *textures), (n, textures))
+GLAD_PROC(VERSION_1_1, PFNGLISTEXTUREPROC, GLboolean, IsTexture, (GLuint texture), (texture))
+GLAD_PROC_VOID(VERSION_1_2, PFNGLDRAWRANGEELEMENTSPROC, DrawRangeElements, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices))
+GLAD_PROC_VOID(VERSION_1_2, PFNGLTEXIMAGE3DPROC, TexImage3D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+GLAD_PROC_VOID(VERSION_1_2, PFNGLTEXSUBIMAGE3DPROC, TexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_PROC_VOID(VERSION_1_2, PFNGLCOPYTEXSUBIMAGE3DPROC, CopyTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_PROC_VOID(VERSION_1_3, PFNGLACTIVETEXTUREPROC, ActiveTexture, (GLenum texture), (texture))
+GLAD_PROC_VOID(VERSION_1_3, PFNGLSAMPLECOVERAGEPROC, SampleCoverage, (GLfloat value, GLboolean invert), (value, invert))
+GLAD_PROC_VOID(VERSION_1_3, PFNGLCOMPRESSEDTEXIMAGE3DPROC, CompressedTexImage3D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+GLAD_PROC_VOID(VERSION_1_3, PFNGLCOMPRESSEDTEXIMAGE2DPROC, CompressedTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data))
+GLAD_PROC_VOID(VERSION_1_3, PFNGLCOMPRESSEDTEXIMAGE1DPROC, CompressedTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data))
+GLAD_PROC_VOID(VERSION_1_3, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, CompressedTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GLAD_PROC_VOID(VERSION_1_3, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, CompressedTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+GLAD_PROC_VOID(VERSION_1_3, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, CompressedTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data))
+GLAD_PROC_VOID(VERSION_1_3, PFNGLGETCOMPRESSEDTEXIMAGEPROC, GetCompressedTexImage, (GLenum target, GLint level, void *img), (target, level, img))
+GLAD_PROC_VOID(VERSION_1_4, PFNGLBLENDFUNCSEPARATEPROC, BlendFuncSeparate, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GLAD_PROC_VOID(VERSION_1_4, PFNGLMULTIDRAWARRAYSPROC, MultiDrawArrays, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount))
+GLAD_PROC_VOID(VERSION_1_4, PFNGLMULTIDRAWELEMENTSPROC, MultiDrawElements, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount))
+GLAD_PROC_VOID(VERSION_1_4, PFNGLPOINTPARAMETERFPROC, PointParameterf, (GLenum pname, GLfloat param), (pname, param))
+GLAD_PROC_VOID(VERSION_1_4, PFNGLPOINTPARAMETERFVPROC, PointParameterfv, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_PROC_VOID(VERSION_1_4, PFNGLPOINTPARAMETERIPROC, PointParameteri, (GLenum pname, GLint param), (pname, param))
+GLAD_PROC_VOID(VERSION_1_4, PFNGLPOINTPARAMETERIVPROC, PointParameteriv, (GLenum pname, const GLint *params), (pname, params))
+GLAD_PROC_VOID(VERSION_1_4, PFNGLBLENDCOLORPROC, BlendColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_PROC_VOID(VERSION_1_4, PFNGLBLENDEQUATIONPROC, BlendEquation, (GLenum mode), (mode))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLGENQUERIESPROC, GenQueries, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLDELETEQUERIESPROC, DeleteQueries, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_PROC(VERSION_1_5, PFNGLISQUERYPROC, GLboolean, IsQuery, (GLuint id), (id))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLBEGINQUERYPROC, BeginQuery, (GLenum target, GLuint id), (target, id))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLENDQUERYPROC, EndQuery, (GLenum target), (target))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLGETQUERYIVPROC, GetQueryiv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLGETQUERYOBJECTIVPROC, GetQueryObjectiv, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLGETQUERYOBJECTUIVPROC, GetQueryObjectuiv, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLBINDBUFFERPROC, BindBuffer, (GLenum target, GLuint buffer), (target, buffer))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLDELETEBUFFERSPROC, DeleteBuffers, (GLsizei n, const GLuint *buffers), (n, buffers))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLGENBUFFERSPROC, GenBuffers, (GLsizei n, GLuint *buffers), (n, buffers))
+GLAD_PROC(VERSION_1_5, PFNGLISBUFFERPROC, GLboolean, IsBuffer, (GLuint buffer), (buffer))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLBUFFERDATAPROC, BufferData, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLBUFFERSUBDATAPROC, BufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLGETBUFFERSUBDATAPROC, GetBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data))
+GLAD_PROC(VERSION_1_5, PFNGLMAPBUFFERPROC, void *, MapBuffer, (GLenum target, GLenum access), (target, access))
+GLAD_PROC(VERSION_1_5, PFNGLUNMAPBUFFERPROC, GLboolean, UnmapBuffer, (GLenum target), (target))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLGETBUFFERPARAMETERIVPROC, GetBufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_PROC_VOID(VERSION_1_5, PFNGLGETBUFFERPOINTERVPROC, GetBufferPointerv, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLBLENDEQUATIONSEPARATEPROC, BlendEquationSeparate, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLDRAWBUFFERSPROC, DrawBuffers, (GLsizei n, const GLenum *bufs), (n, bufs))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLSTENCILOPSEPARATEPROC, StencilOpSeparate, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLSTENCILFUNCSEPARATEPROC, StencilFuncSeparate, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLSTENCILMASKSEPARATEPROC, StencilMaskSeparate, (GLenum face, GLuint mask), (face, mask))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLATTACHSHADERPROC, AttachShader, (GLuint program, GLuint shader), (program, shader))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLBINDATTRIBLOCATIONPROC, BindAttribLocation, (GLuint program, GLuint index, const GLchar *name), (program, index, name))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLCOMPILESHADERPROC, CompileShader, (GLuint shader), (shader))
+GLAD_PROC(VERSION_2_0, PFNGLCREATEPROGRAMPROC, GLuint, CreateProgram, (void), ())
+GLAD_PROC(VERSION_2_0, PFNGLCREATESHADERPROC, GLuint, CreateShader, (GLenum type), (type))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLDELETEPROGRAMPROC, DeleteProgram, (GLuint program), (program))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLDELETESHADERPROC, DeleteShader, (GLuint shader), (shader))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLDETACHSHADERPROC, DetachShader, (GLuint program, GLuint shader), (program, shader))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLDISABLEVERTEXATTRIBARRAYPROC, DisableVertexAttribArray, (GLuint index), (index))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLENABLEVERTEXATTRIBARRAYPROC, EnableVertexAttribArray, (GLuint index), (index))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLGETACTIVEATTRIBPROC, GetActiveAttrib, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLGETACTIVEUNIFORMPROC, GetActiveUniform, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLGETATTACHEDSHADERSPROC, GetAttachedShaders, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders))
+GLAD_PROC(VERSION_2_0, PFNGLGETATTRIBLOCATIONPROC, GLint, GetAttribLocation, (GLuint program, const GLchar *name), (program, name))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLGETPROGRAMIVPROC, GetProgramiv, (GLuint program, GLenum pname, GLint *params), (program, pname, params))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLGETPROGRAMINFOLOGPROC, GetProgramInfoLog, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLGETSHADERIVPROC, GetShaderiv, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLGETSHADERINFOLOGPROC, GetShaderInfoLog, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLGETSHADERSOURCEPROC, GetShaderSource, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source))
+GLAD_PROC(VERSION_2_0, PFNGLGETUNIFORMLOCATIONPROC, GLint, GetUniformLocation, (GLuint program, const GLchar *name), (program, name))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLGETUNIFORMFVPROC, GetUniformfv, (GLuint program, GLint location, GLfloat *params), (program, location, params))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLGETUNIFORMIVPROC, GetUniformiv, (GLuint program, GLint location, GLint *params), (program, location, params))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLGETVERTEXATTRIBDVPROC, GetVertexAttribdv, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLGETVERTEXATTRIBFVPROC, GetVertexAttribfv, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLGETVERTEXATTRIBIVPROC, GetVertexAttribiv, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLGETVERTEXATTRIBPOINTERVPROC, GetVertexAttribPointerv, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GLAD_PROC(VERSION_2_0, PFNGLISPROGRAMPROC, GLboolean, IsProgram, (GLuint program), (program))
+GLAD_PROC(VERSION_2_0, PFNGLISSHADERPROC, GLboolean, IsShader, (GLuint shader), (shader))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLLINKPROGRAMPROC, LinkProgram, (GLuint program), (program))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLSHADERSOURCEPROC, ShaderSource, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUSEPROGRAMPROC, UseProgram, (GLuint program), (program))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM1FPROC, Uniform1f, (GLint location, GLfloat v0), (location, v0))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM2FPROC, Uniform2f, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM3FPROC, Uniform3f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM4FPROC, Uniform4f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM1IPROC, Uniform1i, (GLint location, GLint v0), (location, v0))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM2IPROC, Uniform2i, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM3IPROC, Uniform3i, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM4IPROC, Uniform4i, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM1FVPROC, Uniform1fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM2FVPROC, Uniform2fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM3FVPROC, Uniform3fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM4FVPROC, Uniform4fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM1IVPROC, Uniform1iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM2IVPROC, Uniform2iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM3IVPROC, Uniform3iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORM4IVPROC, Uniform4iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORMMATRIX2FVPROC, UniformMatrix2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORMMATRIX3FVPROC, UniformMatrix3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLUNIFORMMATRIX4FVPROC, UniformMatrix4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVALIDATEPROGRAMPROC, ValidateProgram, (GLuint program), (program))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB1DPROC, VertexAttrib1d, (GLuint index, GLdouble x), (index, x))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB1DVPROC, VertexAttrib1dv, (GLuint index, const GLdouble *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB1FPROC, VertexAttrib1f, (GLuint index, GLfloat x), (index, x))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB1FVPROC, VertexAttrib1fv, (GLuint index, const GLfloat *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB1SPROC, VertexAttrib1s, (GLuint index, GLshort x), (index, x))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB1SVPROC, VertexAttrib1sv, (GLuint index, const GLshort *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB2DPROC, VertexAttrib2d, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB2DVPROC, VertexAttrib2dv, (GLuint index, const GLdouble *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB2FPROC, VertexAttrib2f, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB2FVPROC, VertexAttrib2fv, (GLuint index, const GLfloat *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB2SPROC, VertexAttrib2s, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB2SVPROC, VertexAttrib2sv, (GLuint index, const GLshort *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB3DPROC, VertexAttrib3d, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB3DVPROC, VertexAttrib3dv, (GLuint index, const GLdouble *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB3FPROC, VertexAttrib3f, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB3FVPROC, VertexAttrib3fv, (GLuint index, const GLfloat *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB3SPROC, VertexAttrib3s, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB3SVPROC, VertexAttrib3sv, (GLuint index, const GLshort *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4NBVPROC, VertexAttrib4Nbv, (GLuint index, const GLbyte *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4NIVPROC, VertexAttrib4Niv, (GLuint index, const GLint *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4NSVPROC, VertexAttrib4Nsv, (GLuint index, const GLshort *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4NUBPROC, VertexAttrib4Nub, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4NUBVPROC, VertexAttrib4Nubv, (GLuint index, const GLubyte *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4NUIVPROC, VertexAttrib4Nuiv, (GLuint index, const GLuint *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4NUSVPROC, VertexAttrib4Nusv, (GLuint index, const GLushort *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4BVPROC, VertexAttrib4bv, (GLuint index, const GLbyte *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4DPROC, VertexAttrib4d, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4DVPROC, VertexAttrib4dv, (GLuint index, const GLdouble *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4FPROC, VertexAttrib4f, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4FVPROC, VertexAttrib4fv, (GLuint index, const GLfloat *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4IVPROC, VertexAttrib4iv, (GLuint index, const GLint *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4SPROC, VertexAttrib4s, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4SVPROC, VertexAttrib4sv, (GLuint index, const GLshort *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4UBVPROC, VertexAttrib4ubv, (GLuint index, const GLubyte *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4UIVPROC, VertexAttrib4uiv, (GLuint index, const GLuint *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIB4USVPROC, VertexAttrib4usv, (GLuint index, const GLushort *v), (index, v))
+GLAD_PROC_VOID(VERSION_2_0, PFNGLVERTEXATTRIBPOINTERPROC, VertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+GLAD_PROC_VOID(VERSION_2_1, PFNGLUNIFORMMATRIX2X3FVPROC, UniformMatrix2x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_2_1, PFNGLUNIFORMMATRIX3X2FVPROC, UniformMatrix3x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_2_1, PFNGLUNIFORMMATRIX2X4FVPROC, UniformMatrix2x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_2_1, PFNGLUNIFORMMATRIX4X2FVPROC, UniformMatrix4x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_2_1, PFNGLUNIFORMMATRIX3X4FVPROC, UniformMatrix3x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_2_1, PFNGLUNIFORMMATRIX4X3FVPROC, UniformMatrix4x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLCOLORMASKIPROC, ColorMaski, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLGETBOOLEANI_VPROC, GetBooleani_v, (GLenum target, GLuint index, GLboolean *data), (target, index, data))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLGETINTEGERI_VPROC, GetIntegeri_v, (GLenum target, GLuint index, GLint *data), (target, index, data))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLENABLEIPROC, Enablei, (GLenum target, GLuint index), (target, index))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLDISABLEIPROC, Disablei, (GLenum target, GLuint index), (target, index))
+GLAD_PROC(VERSION_3_0, PFNGLISENABLEDIPROC, GLboolean, IsEnabledi, (GLenum target, GLuint index), (target, index))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLBEGINTRANSFORMFEEDBACKPROC, BeginTransformFeedback, (GLenum primitiveMode), (primitiveMode))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLENDTRANSFORMFEEDBACKPROC, EndTransformFeedback, (void), ())
+GLAD_PROC_VOID(VERSION_3_0, PFNGLBINDBUFFERRANGEPROC, BindBufferRange, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLBINDBUFFERBASEPROC, BindBufferBase, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLTRANSFORMFEEDBACKVARYINGSPROC, TransformFeedbackVaryings, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, GetTransformFeedbackVarying, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLCLAMPCOLORPROC, ClampColor, (GLenum target, GLenum clamp), (target, clamp))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLBEGINCONDITIONALRENDERPROC, BeginConditionalRender, (GLuint id, GLenum mode), (id, mode))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLENDCONDITIONALRENDERPROC, EndConditionalRender, (void), ())
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBIPOINTERPROC, VertexAttribIPointer, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLGETVERTEXATTRIBIIVPROC, GetVertexAttribIiv, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLGETVERTEXATTRIBIUIVPROC, GetVertexAttribIuiv, (GLuint index, GLenum pname, GLuint *params), (index, pname, params))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI1IPROC, VertexAttribI1i, (GLuint index, GLint x), (index, x))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI2IPROC, VertexAttribI2i, (GLuint index, GLint x, GLint y), (index, x, y))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI3IPROC, VertexAttribI3i, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI4IPROC, VertexAttribI4i, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI1UIPROC, VertexAttribI1ui, (GLuint index, GLuint x), (index, x))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI2UIPROC, VertexAttribI2ui, (GLuint index, GLuint x, GLuint y), (index, x, y))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI3UIPROC, VertexAttribI3ui, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI4UIPROC, VertexAttribI4ui, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI1IVPROC, VertexAttribI1iv, (GLuint index, const GLint *v), (index, v))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI2IVPROC, VertexAttribI2iv, (GLuint index, const GLint *v), (index, v))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI3IVPROC, VertexAttribI3iv, (GLuint index, const GLint *v), (index, v))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI4IVPROC, VertexAttribI4iv, (GLuint index, const GLint *v), (index, v))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI1UIVPROC, VertexAttribI1uiv, (GLuint index, const GLuint *v), (index, v))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI2UIVPROC, VertexAttribI2uiv, (GLuint index, const GLuint *v), (index, v))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI3UIVPROC, VertexAttribI3uiv, (GLuint index, const GLuint *v), (index, v))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI4UIVPROC, VertexAttribI4uiv, (GLuint index, const GLuint *v), (index, v))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI4BVPROC, VertexAttribI4bv, (GLuint index, const GLbyte *v), (index, v))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI4SVPROC, VertexAttribI4sv, (GLuint index, const GLshort *v), (index, v))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI4UBVPROC, VertexAttribI4ubv, (GLuint index, const GLubyte *v), (index, v))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLVERTEXATTRIBI4USVPROC, VertexAttribI4usv, (GLuint index, const GLushort *v), (index, v))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLGETUNIFORMUIVPROC, GetUniformuiv, (GLuint program, GLint location, GLuint *params), (program, location, params))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLBINDFRAGDATALOCATIONPROC, BindFragDataLocation, (GLuint program, GLuint color, const GLchar *name), (program, color, name))
+GLAD_PROC(VERSION_3_0, PFNGLGETFRAGDATALOCATIONPROC, GLint, GetFragDataLocation, (GLuint program, const GLchar *name), (program, name))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLUNIFORM1UIPROC, Uniform1ui, (GLint location, GLuint v0), (location, v0))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLUNIFORM2UIPROC, Uniform2ui, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLUNIFORM3UIPROC, Uniform3ui, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLUNIFORM4UIPROC, Uniform4ui, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLUNIFORM1UIVPROC, Uniform1uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLUNIFORM2UIVPROC, Uniform2uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLUNIFORM3UIVPROC, Uniform3uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLUNIFORM4UIVPROC, Uniform4uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLTEXPARAMETERIIVPROC, TexParameterIiv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLTEXPARAMETERIUIVPROC, TexParameterIuiv, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLGETTEXPARAMETERIIVPROC, GetTexParameterIiv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLGETTEXPARAMETERIUIVPROC, GetTexParameterIuiv, (GLenum target, GLenum pname, GLuint *params), (target, pname, params))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLCLEARBUFFERIVPROC, ClearBufferiv, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLCLEARBUFFERUIVPROC, ClearBufferuiv, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLCLEARBUFFERFVPROC, ClearBufferfv, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLCLEARBUFFERFIPROC, ClearBufferfi, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil))
+GLAD_PROC(VERSION_3_0, PFNGLGETSTRINGIPROC, const GLubyte *, GetStringi, (GLenum name, GLuint index), (name, index))
+GLAD_PROC(VERSION_3_0, PFNGLISRENDERBUFFERPROC, GLboolean, IsRenderbuffer, (GLuint renderbuffer), (renderbuffer))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLBINDRENDERBUFFERPROC, BindRenderbuffer, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLDELETERENDERBUFFERSPROC, DeleteRenderbuffers, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLGENRENDERBUFFERSPROC, GenRenderbuffers, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLRENDERBUFFERSTORAGEPROC, RenderbufferStorage, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLGETRENDERBUFFERPARAMETERIVPROC, GetRenderbufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_PROC(VERSION_3_0, PFNGLISFRAMEBUFFERPROC, GLboolean, IsFramebuffer, (GLuint framebuffer), (framebuffer))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLBINDFRAMEBUFFERPROC, BindFramebuffer, (GLenum target, GLuint framebuffer), (target, framebuffer))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLDELETEFRAMEBUFFERSPROC, DeleteFramebuffers, (GLsizei n, const GLuint *framebuffers), (n, framebuffers))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLGENFRAMEBUFFERSPROC, GenFramebuffers, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GLAD_PROC(VERSION_3_0, PFNGLCHECKFRAMEBUFFERSTATUSPROC, GLenum, CheckFramebufferStatus, (GLenum target), (target))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLFRAMEBUFFERTEXTURE1DPROC, FramebufferTexture1D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLFRAMEBUFFERTEXTURE2DPROC, FramebufferTexture2D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLFRAMEBUFFERTEXTURE3DPROC, FramebufferTexture3D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLFRAMEBUFFERRENDERBUFFERPROC, FramebufferRenderbuffer, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, GetFramebufferAttachmentParameteriv, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLGENERATEMIPMAPPROC, GenerateMipmap, (GLenum target), (target))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLBLITFRAMEBUFFERPROC, BlitFramebuffer, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, RenderbufferStorageMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLFRAMEBUFFERTEXTURELAYERPROC, FramebufferTextureLayer, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GLAD_PROC(VERSION_3_0, PFNGLMAPBUFFERRANGEPROC, void *, MapBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLFLUSHMAPPEDBUFFERRANGEPROC, FlushMappedBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLBINDVERTEXARRAYPROC, BindVertexArray, (GLuint array), (array))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLDELETEVERTEXARRAYSPROC, DeleteVertexArrays, (GLsizei n, const GLuint *arrays), (n, arrays))
+GLAD_PROC_VOID(VERSION_3_0, PFNGLGENVERTEXARRAYSPROC, GenVertexArrays, (GLsizei n, GLuint *arrays), (n, arrays))
+GLAD_PROC(VERSION_3_0, PFNGLISVERTEXARRAYPROC, GLboolean, IsVertexArray, (GLuint array), (array))
+GLAD_PROC_VOID(VERSION_3_1, PFNGLDRAWARRAYSINSTANCEDPROC, DrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount))
+GLAD_PROC_VOID(VERSION_3_1, PFNGLDRAWELEMENTSINSTANCEDPROC, DrawElementsInstanced, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount))
+GLAD_PROC_VOID(VERSION_3_1, PFNGLTEXBUFFERPROC, TexBuffer, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GLAD_PROC_VOID(VERSION_3_1, PFNGLPRIMITIVERESTARTINDEXPROC, PrimitiveRestartIndex, (GLuint index), (index))
+GLAD_PROC_VOID(VERSION_3_1, PFNGLCOPYBUFFERSUBDATAPROC, CopyBufferSubData, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size))
+GLAD_PROC_VOID(VERSION_3_1, PFNGLGETUNIFORMINDICESPROC, GetUniformIndices, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices))
+GLAD_PROC_VOID(VERSION_3_1, PFNGLGETACTIVEUNIFORMSIVPROC, GetActiveUniformsiv, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params))
+GLAD_PROC_VOID(VERSION_3_1, PFNGLGETACTIVEUNIFORMNAMEPROC, GetActiveUniformName, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName))
+GLAD_PROC(VERSION_3_1, PFNGLGETUNIFORMBLOCKINDEXPROC, GLuint, GetUniformBlockIndex, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName))
+GLAD_PROC_VOID(VERSION_3_1, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, GetActiveUniformBlockiv, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params))
+GLAD_PROC_VOID(VERSION_3_1, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, GetActiveUniformBlockName, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName))
+GLAD_PROC_VOID(VERSION_3_1, PFNGLUNIFORMBLOCKBINDINGPROC, UniformBlockBinding, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLDRAWELEMENTSBASEVERTEXPROC, DrawElementsBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, DrawRangeElementsBaseVertex, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, DrawElementsInstancedBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, MultiDrawElementsBaseVertex, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLPROVOKINGVERTEXPROC, ProvokingVertex, (GLenum mode), (mode))
+GLAD_PROC(VERSION_3_2, PFNGLFENCESYNCPROC, GLsync, FenceSync, (GLenum condition, GLbitfield flags), (condition, flags))
+GLAD_PROC(VERSION_3_2, PFNGLISSYNCPROC, GLboolean, IsSync, (GLsync sync), (sync))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLDELETESYNCPROC, DeleteSync, (GLsync sync), (sync))
+GLAD_PROC(VERSION_3_2, PFNGLCLIENTWAITSYNCPROC, GLenum, ClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLWAITSYNCPROC, WaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLGETINTEGER64VPROC, GetInteger64v, (GLenum pname, GLint64 *data), (pname, data))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLGETSYNCIVPROC, GetSynciv, (GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values), (sync, pname, count, length, values))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLGETINTEGER64I_VPROC, GetInteger64i_v, (GLenum target, GLuint index, GLint64 *data), (target, index, data))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLGETBUFFERPARAMETERI64VPROC, GetBufferParameteri64v, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLFRAMEBUFFERTEXTUREPROC, FramebufferTexture, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLTEXIMAGE2DMULTISAMPLEPROC, TexImage2DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLTEXIMAGE3DMULTISAMPLEPROC, TexImage3DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLGETMULTISAMPLEFVPROC, GetMultisamplefv, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val))
+GLAD_PROC_VOID(VERSION_3_2, PFNGLSAMPLEMASKIPROC, SampleMaski, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, BindFragDataLocationIndexed, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name))
+GLAD_PROC(VERSION_3_3, PFNGLGETFRAGDATAINDEXPROC, GLint, GetFragDataIndex, (GLuint program, const GLchar *name), (program, name))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLGENSAMPLERSPROC, GenSamplers, (GLsizei count, GLuint *samplers), (count, samplers))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLDELETESAMPLERSPROC, DeleteSamplers, (GLsizei count, const GLuint *samplers), (count, samplers))
+GLAD_PROC(VERSION_3_3, PFNGLISSAMPLERPROC, GLboolean, IsSampler, (GLuint sampler), (sampler))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLBINDSAMPLERPROC, BindSampler, (GLuint unit, GLuint sampler), (unit, sampler))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLSAMPLERPARAMETERIPROC, SamplerParameteri, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLSAMPLERPARAMETERIVPROC, SamplerParameteriv, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLSAMPLERPARAMETERFPROC, SamplerParameterf, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLSAMPLERPARAMETERFVPROC, SamplerParameterfv, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLSAMPLERPARAMETERIIVPROC, SamplerParameterIiv, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLSAMPLERPARAMETERIUIVPROC, SamplerParameterIuiv, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLGETSAMPLERPARAMETERIVPROC, GetSamplerParameteriv, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLGETSAMPLERPARAMETERIIVPROC, GetSamplerParameterIiv, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLGETSAMPLERPARAMETERFVPROC, GetSamplerParameterfv, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLGETSAMPLERPARAMETERIUIVPROC, GetSamplerParameterIuiv, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLQUERYCOUNTERPROC, QueryCounter, (GLuint id, GLenum target), (id, target))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLGETQUERYOBJECTI64VPROC, GetQueryObjecti64v, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLGETQUERYOBJECTUI64VPROC, GetQueryObjectui64v, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXATTRIBDIVISORPROC, VertexAttribDivisor, (GLuint index, GLuint divisor), (index, divisor))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXATTRIBP1UIPROC, VertexAttribP1ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXATTRIBP1UIVPROC, VertexAttribP1uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXATTRIBP2UIPROC, VertexAttribP2ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXATTRIBP2UIVPROC, VertexAttribP2uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXATTRIBP3UIPROC, VertexAttribP3ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXATTRIBP3UIVPROC, VertexAttribP3uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXATTRIBP4UIPROC, VertexAttribP4ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXATTRIBP4UIVPROC, VertexAttribP4uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXP2UIPROC, VertexP2ui, (GLenum type, GLuint value), (type, value))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXP2UIVPROC, VertexP2uiv, (GLenum type, const GLuint *value), (type, value))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXP3UIPROC, VertexP3ui, (GLenum type, GLuint value), (type, value))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXP3UIVPROC, VertexP3uiv, (GLenum type, const GLuint *value), (type, value))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXP4UIPROC, VertexP4ui, (GLenum type, GLuint value), (type, value))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLVERTEXP4UIVPROC, VertexP4uiv, (GLenum type, const GLuint *value), (type, value))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLTEXCOORDP1UIPROC, TexCoordP1ui, (GLenum type, GLuint coords), (type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLTEXCOORDP1UIVPROC, TexCoordP1uiv, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLTEXCOORDP2UIPROC, TexCoordP2ui, (GLenum type, GLuint coords), (type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLTEXCOORDP2UIVPROC, TexCoordP2uiv, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLTEXCOORDP3UIPROC, TexCoordP3ui, (GLenum type, GLuint coords), (type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLTEXCOORDP3UIVPROC, TexCoordP3uiv, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLTEXCOORDP4UIPROC, TexCoordP4ui, (GLenum type, GLuint coords), (type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLTEXCOORDP4UIVPROC, TexCoordP4uiv, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLMULTITEXCOORDP1UIPROC, MultiTexCoordP1ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLMULTITEXCOORDP1UIVPROC, MultiTexCoordP1uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLMULTITEXCOORDP2UIPROC, MultiTexCoordP2ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLMULTITEXCOORDP2UIVPROC, MultiTexCoordP2uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLMULTITEXCOORDP3UIPROC, MultiTexCoordP3ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLMULTITEXCOORDP3UIVPROC, MultiTexCoordP3uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLMULTITEXCOORDP4UIPROC, MultiTexCoordP4ui, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLMULTITEXCOORDP4UIVPROC, MultiTexCoordP4uiv, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLNORMALP3UIPROC, NormalP3ui, (GLenum type, GLuint coords), (type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLNORMALP3UIVPROC, NormalP3uiv, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLCOLORP3UIPROC, ColorP3ui, (GLenum type, GLuint color), (type, color))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLCOLORP3UIVPROC, ColorP3uiv, (GLenum type, const GLuint *color), (type, color))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLCOLORP4UIPROC, ColorP4ui, (GLenum type, GLuint color), (type, color))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLCOLORP4UIVPROC, ColorP4uiv, (GLenum type, const GLuint *color), (type, color))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLSECONDARYCOLORP3UIPROC, SecondaryColorP3ui, (GLenum type, GLuint color), (type, color))
+GLAD_PROC_VOID(VERSION_3_3, PFNGLSECONDARYCOLORP3UIVPROC, SecondaryColorP3uiv, (GLenum type, const GLuint *color), (type, color))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLMINSAMPLESHADINGPROC, MinSampleShading, (GLfloat value), (value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLBLENDEQUATIONIPROC, BlendEquationi, (GLuint buf, GLenum mode), (buf, mode))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLBLENDEQUATIONSEPARATEIPROC, BlendEquationSeparatei, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLBLENDFUNCIPROC, BlendFunci, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLBLENDFUNCSEPARATEIPROC, BlendFuncSeparatei, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLDRAWARRAYSINDIRECTPROC, DrawArraysIndirect, (GLenum mode, const void *indirect), (mode, indirect))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLDRAWELEMENTSINDIRECTPROC, DrawElementsIndirect, (GLenum mode, GLenum type, const void *indirect), (mode, type, indirect))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORM1DPROC, Uniform1d, (GLint location, GLdouble x), (location, x))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORM2DPROC, Uniform2d, (GLint location, GLdouble x, GLdouble y), (location, x, y))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORM3DPROC, Uniform3d, (GLint location, GLdouble x, GLdouble y, GLdouble z), (location, x, y, z))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORM4DPROC, Uniform4d, (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (location, x, y, z, w))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORM1DVPROC, Uniform1dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORM2DVPROC, Uniform2dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORM3DVPROC, Uniform3dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORM4DVPROC, Uniform4dv, (GLint location, GLsizei count, const GLdouble *value), (location, count, value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORMMATRIX2DVPROC, UniformMatrix2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORMMATRIX3DVPROC, UniformMatrix3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORMMATRIX4DVPROC, UniformMatrix4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORMMATRIX2X3DVPROC, UniformMatrix2x3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORMMATRIX2X4DVPROC, UniformMatrix2x4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORMMATRIX3X2DVPROC, UniformMatrix3x2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORMMATRIX3X4DVPROC, UniformMatrix3x4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORMMATRIX4X2DVPROC, UniformMatrix4x2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORMMATRIX4X3DVPROC, UniformMatrix4x3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLGETUNIFORMDVPROC, GetUniformdv, (GLuint program, GLint location, GLdouble *params), (program, location, params))
+GLAD_PROC(VERSION_4_0, PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC, GLint, GetSubroutineUniformLocation, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name))
+GLAD_PROC(VERSION_4_0, PFNGLGETSUBROUTINEINDEXPROC, GLuint, GetSubroutineIndex, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC, GetActiveSubroutineUniformiv, (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values), (program, shadertype, index, pname, values))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC, GetActiveSubroutineUniformName, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, shadertype, index, bufSize, length, name))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLGETACTIVESUBROUTINENAMEPROC, GetActiveSubroutineName, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, shadertype, index, bufSize, length, name))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLUNIFORMSUBROUTINESUIVPROC, UniformSubroutinesuiv, (GLenum shadertype, GLsizei count, const GLuint *indices), (shadertype, count, indices))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLGETUNIFORMSUBROUTINEUIVPROC, GetUniformSubroutineuiv, (GLenum shadertype, GLint location, GLuint *params), (shadertype, location, params))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLGETPROGRAMSTAGEIVPROC, GetProgramStageiv, (GLuint program, GLenum shadertype, GLenum pname, GLint *values), (program, shadertype, pname, values))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLPATCHPARAMETERIPROC, PatchParameteri, (GLenum pname, GLint value), (pname, value))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLPATCHPARAMETERFVPROC, PatchParameterfv, (GLenum pname, const GLfloat *values), (pname, values))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLBINDTRANSFORMFEEDBACKPROC, BindTransformFeedback, (GLenum target, GLuint id), (target, id))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLDELETETRANSFORMFEEDBACKSPROC, DeleteTransformFeedbacks, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLGENTRANSFORMFEEDBACKSPROC, GenTransformFeedbacks, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_PROC(VERSION_4_0, PFNGLISTRANSFORMFEEDBACKPROC, GLboolean, IsTransformFeedback, (GLuint id), (id))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLPAUSETRANSFORMFEEDBACKPROC, PauseTransformFeedback, (void), ())
+GLAD_PROC_VOID(VERSION_4_0, PFNGLRESUMETRANSFORMFEEDBACKPROC, ResumeTransformFeedback, (void), ())
+GLAD_PROC_VOID(VERSION_4_0, PFNGLDRAWTRANSFORMFEEDBACKPROC, DrawTransformFeedback, (GLenum mode, GLuint id), (mode, id))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC, DrawTransformFeedbackStream, (GLenum mode, GLuint id, GLuint stream), (mode, id, stream))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLBEGINQUERYINDEXEDPROC, BeginQueryIndexed, (GLenum target, GLuint index, GLuint id), (target, index, id))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLENDQUERYINDEXEDPROC, EndQueryIndexed, (GLenum target, GLuint index), (target, index))
+GLAD_PROC_VOID(VERSION_4_0, PFNGLGETQUERYINDEXEDIVPROC, GetQueryIndexediv, (GLenum target, GLuint index, GLenum pname, GLint *params), (target, index, pname, params))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLRELEASESHADERCOMPILERPROC, ReleaseShaderCompiler, (void), ())
+GLAD_PROC_VOID(VERSION_4_1, PFNGLSHADERBINARYPROC, ShaderBinary, (GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length), (count, shaders, binaryFormat, binary, length))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLGETSHADERPRECISIONFORMATPROC, GetShaderPrecisionFormat, (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision), (shadertype, precisiontype, range, precision))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLDEPTHRANGEFPROC, DepthRangef, (GLfloat n, GLfloat f), (n, f))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLCLEARDEPTHFPROC, ClearDepthf, (GLfloat d), (d))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLGETPROGRAMBINARYPROC, GetProgramBinary, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMBINARYPROC, ProgramBinary, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMPARAMETERIPROC, ProgramParameteri, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLUSEPROGRAMSTAGESPROC, UseProgramStages, (GLuint pipeline, GLbitfield stages, GLuint program), (pipeline, stages, program))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLACTIVESHADERPROGRAMPROC, ActiveShaderProgram, (GLuint pipeline, GLuint program), (pipeline, program))
+GLAD_PROC(VERSION_4_1, PFNGLCREATESHADERPROGRAMVPROC, GLuint, CreateShaderProgramv, (GLenum type, GLsizei count, const GLchar *const*strings), (type, count, strings))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLBINDPROGRAMPIPELINEPROC, BindProgramPipeline, (GLuint pipeline), (pipeline))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLDELETEPROGRAMPIPELINESPROC, DeleteProgramPipelines, (GLsizei n, const GLuint *pipelines), (n, pipelines))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLGENPROGRAMPIPELINESPROC, GenProgramPipelines, (GLsizei n, GLuint *pipelines), (n, pipelines))
+GLAD_PROC(VERSION_4_1, PFNGLISPROGRAMPIPELINEPROC, GLboolean, IsProgramPipeline, (GLuint pipeline), (pipeline))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLGETPROGRAMPIPELINEIVPROC, GetProgramPipelineiv, (GLuint pipeline, GLenum pname, GLint *params), (pipeline, pname, params))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM1IPROC, ProgramUniform1i, (GLuint program, GLint location, GLint v0), (program, location, v0))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM1IVPROC, ProgramUniform1iv, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM1FPROC, ProgramUniform1f, (GLuint program, GLint location, GLfloat v0), (program, location, v0))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM1FVPROC, ProgramUniform1fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM1DPROC, ProgramUniform1d, (GLuint program, GLint location, GLdouble v0), (program, location, v0))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM1DVPROC, ProgramUniform1dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM1UIPROC, ProgramUniform1ui, (GLuint program, GLint location, GLuint v0), (program, location, v0))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM1UIVPROC, ProgramUniform1uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM2IPROC, ProgramUniform2i, (GLuint program, GLint location, GLint v0, GLint v1), (program, location, v0, v1))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM2IVPROC, ProgramUniform2iv, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM2FPROC, ProgramUniform2f, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM2FVPROC, ProgramUniform2fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM2DPROC, ProgramUniform2d, (GLuint program, GLint location, GLdouble v0, GLdouble v1), (program, location, v0, v1))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM2DVPROC, ProgramUniform2dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM2UIPROC, ProgramUniform2ui, (GLuint program, GLint location, GLuint v0, GLuint v1), (program, location, v0, v1))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM2UIVPROC, ProgramUniform2uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM3IPROC, ProgramUniform3i, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2), (program, location, v0, v1, v2))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM3IVPROC, ProgramUniform3iv, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM3FPROC, ProgramUniform3f, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM3FVPROC, ProgramUniform3fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM3DPROC, ProgramUniform3d, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2), (program, location, v0, v1, v2))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM3DVPROC, ProgramUniform3dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM3UIPROC, ProgramUniform3ui, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2), (program, location, v0, v1, v2))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM3UIVPROC, ProgramUniform3uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM4IPROC, ProgramUniform4i, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (program, location, v0, v1, v2, v3))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM4IVPROC, ProgramUniform4iv, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM4FPROC, ProgramUniform4f, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM4FVPROC, ProgramUniform4fv, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM4DPROC, ProgramUniform4d, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3), (program, location, v0, v1, v2, v3))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM4DVPROC, ProgramUniform4dv, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM4UIPROC, ProgramUniform4ui, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (program, location, v0, v1, v2, v3))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORM4UIVPROC, ProgramUniform4uiv, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX2FVPROC, ProgramUniformMatrix2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX3FVPROC, ProgramUniformMatrix3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX4FVPROC, ProgramUniformMatrix4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX2DVPROC, ProgramUniformMatrix2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX3DVPROC, ProgramUniformMatrix3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX4DVPROC, ProgramUniformMatrix4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC, ProgramUniformMatrix2x3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC, ProgramUniformMatrix3x2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC, ProgramUniformMatrix2x4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC, ProgramUniformMatrix4x2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC, ProgramUniformMatrix3x4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC, ProgramUniformMatrix4x3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC, ProgramUniformMatrix2x3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC, ProgramUniformMatrix3x2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC, ProgramUniformMatrix2x4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC, ProgramUniformMatrix4x2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC, ProgramUniformMatrix3x4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC, ProgramUniformMatrix4x3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLVALIDATEPROGRAMPIPELINEPROC, ValidateProgramPipeline, (GLuint pipeline), (pipeline))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLGETPROGRAMPIPELINEINFOLOGPROC, GetProgramPipelineInfoLog, (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (pipeline, bufSize, length, infoLog))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLVERTEXATTRIBL1DPROC, VertexAttribL1d, (GLuint index, GLdouble x), (index, x))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLVERTEXATTRIBL2DPROC, VertexAttribL2d, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLVERTEXATTRIBL3DPROC, VertexAttribL3d, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLVERTEXATTRIBL4DPROC, VertexAttribL4d, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLVERTEXATTRIBL1DVPROC, VertexAttribL1dv, (GLuint index, const GLdouble *v), (index, v))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLVERTEXATTRIBL2DVPROC, VertexAttribL2dv, (GLuint index, const GLdouble *v), (index, v))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLVERTEXATTRIBL3DVPROC, VertexAttribL3dv, (GLuint index, const GLdouble *v), (index, v))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLVERTEXATTRIBL4DVPROC, VertexAttribL4dv, (GLuint index, const GLdouble *v), (index, v))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLVERTEXATTRIBLPOINTERPROC, VertexAttribLPointer, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLGETVERTEXATTRIBLDVPROC, GetVertexAttribLdv, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLVIEWPORTARRAYVPROC, ViewportArrayv, (GLuint first, GLsizei count, const GLfloat *v), (first, count, v))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLVIEWPORTINDEXEDFPROC, ViewportIndexedf, (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h), (index, x, y, w, h))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLVIEWPORTINDEXEDFVPROC, ViewportIndexedfv, (GLuint index, const GLfloat *v), (index, v))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLSCISSORARRAYVPROC, ScissorArrayv, (GLuint first, GLsizei count, const GLint *v), (first, count, v))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLSCISSORINDEXEDPROC, ScissorIndexed, (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height), (index, left, bottom, width, height))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLSCISSORINDEXEDVPROC, ScissorIndexedv, (GLuint index, const GLint *v), (index, v))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLDEPTHRANGEARRAYVPROC, DepthRangeArrayv, (GLuint first, GLsizei count, const GLdouble *v), (first, count, v))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLDEPTHRANGEINDEXEDPROC, DepthRangeIndexed, (GLuint index, GLdouble n, GLdouble f), (index, n, f))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLGETFLOATI_VPROC, GetFloati_v, (GLenum target, GLuint index, GLfloat *data), (target, index, data))
+GLAD_PROC_VOID(VERSION_4_1, PFNGLGETDOUBLEI_VPROC, GetDoublei_v, (GLenum target, GLuint index, GLdouble *data), (target, index, data))
+GLAD_PROC_VOID(VERSION_4_2, PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC, DrawArraysInstancedBaseInstance, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance), (mode, first, count, instancecount, baseinstance))
+GLAD_PROC_VOID(VERSION_4_2, PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC, DrawElementsInstancedBaseInstance, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance), (mode, count, type, indices, instancecount, baseinstance))
+GLAD_PROC_VOID(VERSION_4_2, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC, DrawElementsInstancedBaseVertexBaseInstance, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance), (mode, count, type, indices, instancecount, basevertex, baseinstance))
+GLAD_PROC_VOID(VERSION_4_2, PFNGLGETINTERNALFORMATIVPROC, GetInternalformativ, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params), (target, internalformat, pname, count, params))
+GLAD_PROC_VOID(VERSION_4_2, PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC, GetActiveAtomicCounterBufferiv, (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params), (program, bufferIndex, pname, params))
+GLAD_PROC_VOID(VERSION_4_2, PFNGLBINDIMAGETEXTUREPROC, BindImageTexture, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format))
+GLAD_PROC_VOID(VERSION_4_2, PFNGLMEMORYBARRIERPROC, MemoryBarrier, (GLbitfield barriers), (barriers))
+GLAD_PROC_VOID(VERSION_4_2, PFNGLTEXSTORAGE1DPROC, TexStorage1D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width), (target, levels, internalformat, width))
+GLAD_PROC_VOID(VERSION_4_2, PFNGLTEXSTORAGE2DPROC, TexStorage2D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (target, levels, internalformat, width, height))
+GLAD_PROC_VOID(VERSION_4_2, PFNGLTEXSTORAGE3DPROC, TexStorage3D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (target, levels, internalformat, width, height, depth))
+GLAD_PROC_VOID(VERSION_4_2, PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC, DrawTransformFeedbackInstanced, (GLenum mode, GLuint id, GLsizei instancecount), (mode, id, instancecount))
+GLAD_PROC_VOID(VERSION_4_2, PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC, DrawTransformFeedbackStreamInstanced, (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount), (mode, id, stream, instancecount))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLCLEARBUFFERDATAPROC, ClearBufferData, (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data), (target, internalformat, format, type, data))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLCLEARBUFFERSUBDATAPROC, ClearBufferSubData, (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (target, internalformat, offset, size, format, type, data))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLDISPATCHCOMPUTEPROC, DispatchCompute, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z), (num_groups_x, num_groups_y, num_groups_z))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLDISPATCHCOMPUTEINDIRECTPROC, DispatchComputeIndirect, (GLintptr indirect), (indirect))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLCOPYIMAGESUBDATAPROC, CopyImageSubData, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth), (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLFRAMEBUFFERPARAMETERIPROC, FramebufferParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLGETFRAMEBUFFERPARAMETERIVPROC, GetFramebufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLGETINTERNALFORMATI64VPROC, GetInternalformati64v, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params), (target, internalformat, pname, count, params))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLINVALIDATETEXSUBIMAGEPROC, InvalidateTexSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth), (texture, level, xoffset, yoffset, zoffset, width, height, depth))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLINVALIDATETEXIMAGEPROC, InvalidateTexImage, (GLuint texture, GLint level), (texture, level))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLINVALIDATEBUFFERSUBDATAPROC, InvalidateBufferSubData, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLINVALIDATEBUFFERDATAPROC, InvalidateBufferData, (GLuint buffer), (buffer))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLINVALIDATEFRAMEBUFFERPROC, InvalidateFramebuffer, (GLenum target, GLsizei numAttachments, const GLenum *attachments), (target, numAttachments, attachments))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLINVALIDATESUBFRAMEBUFFERPROC, InvalidateSubFramebuffer, (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (target, numAttachments, attachments, x, y, width, height))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLMULTIDRAWARRAYSINDIRECTPROC, MultiDrawArraysIndirect, (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, indirect, drawcount, stride))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLMULTIDRAWELEMENTSINDIRECTPROC, MultiDrawElementsIndirect, (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, type, indirect, drawcount, stride))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLGETPROGRAMINTERFACEIVPROC, GetProgramInterfaceiv, (GLuint program, GLenum programInterface, GLenum pname, GLint *params), (program, programInterface, pname, params))
+GLAD_PROC(VERSION_4_3, PFNGLGETPROGRAMRESOURCEINDEXPROC, GLuint, GetProgramResourceIndex, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLGETPROGRAMRESOURCENAMEPROC, GetProgramResourceName, (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, programInterface, index, bufSize, length, name))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLGETPROGRAMRESOURCEIVPROC, GetProgramResourceiv, (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params), (program, programInterface, index, propCount, props, count, length, params))
+GLAD_PROC(VERSION_4_3, PFNGLGETPROGRAMRESOURCELOCATIONPROC, GLint, GetProgramResourceLocation, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GLAD_PROC(VERSION_4_3, PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC, GLint, GetProgramResourceLocationIndex, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLSHADERSTORAGEBLOCKBINDINGPROC, ShaderStorageBlockBinding, (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding), (program, storageBlockIndex, storageBlockBinding))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLTEXBUFFERRANGEPROC, TexBufferRange, (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, internalformat, buffer, offset, size))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLTEXSTORAGE2DMULTISAMPLEPROC, TexStorage2DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLTEXSTORAGE3DMULTISAMPLEPROC, TexStorage3DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLTEXTUREVIEWPROC, TextureView, (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers), (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLBINDVERTEXBUFFERPROC, BindVertexBuffer, (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (bindingindex, buffer, offset, stride))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLVERTEXATTRIBFORMATPROC, VertexAttribFormat, (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (attribindex, size, type, normalized, relativeoffset))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLVERTEXATTRIBIFORMATPROC, VertexAttribIFormat, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLVERTEXATTRIBLFORMATPROC, VertexAttribLFormat, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLVERTEXATTRIBBINDINGPROC, VertexAttribBinding, (GLuint attribindex, GLuint bindingindex), (attribindex, bindingindex))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLVERTEXBINDINGDIVISORPROC, VertexBindingDivisor, (GLuint bindingindex, GLuint divisor), (bindingindex, divisor))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLDEBUGMESSAGECONTROLPROC, DebugMessageControl, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLDEBUGMESSAGEINSERTPROC, DebugMessageInsert, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLDEBUGMESSAGECALLBACKPROC, DebugMessageCallback, (GLDEBUGPROC callback, const void *userParam), (callback, userParam))
+GLAD_PROC(VERSION_4_3, PFNGLGETDEBUGMESSAGELOGPROC, GLuint, GetDebugMessageLog, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLPUSHDEBUGGROUPPROC, PushDebugGroup, (GLenum source, GLuint id, GLsizei length, const GLchar *message), (source, id, length, message))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLPOPDEBUGGROUPPROC, PopDebugGroup, (void), ())
+GLAD_PROC_VOID(VERSION_4_3, PFNGLOBJECTLABELPROC, ObjectLabel, (GLenum identifier, GLuint name, GLsizei length, const GLchar *label), (identifier, name, length, label))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLGETOBJECTLABELPROC, GetObjectLabel, (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label), (identifier, name, bufSize, length, label))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLOBJECTPTRLABELPROC, ObjectPtrLabel, (const void *ptr, GLsizei length, const GLchar *label), (ptr, length, label))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLGETOBJECTPTRLABELPROC, GetObjectPtrLabel, (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label), (ptr, bufSize, length, label))
+GLAD_PROC_VOID(VERSION_4_3, PFNGLGETPOINTERVPROC, GetPointerv, (GLenum pname, void **params), (pname, params))
+GLAD_PROC_VOID(VERSION_4_4, PFNGLBUFFERSTORAGEPROC, BufferStorage, (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags), (target, size, data, flags))
+GLAD_PROC_VOID(VERSION_4_4, PFNGLCLEARTEXIMAGEPROC, ClearTexImage, (GLuint texture, GLint level, GLenum format, GLenum type, const void *data), (texture, level, format, type, data))
+GLAD_PROC_VOID(VERSION_4_4, PFNGLCLEARTEXSUBIMAGEPROC, ClearTexSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data))
+GLAD_PROC_VOID(VERSION_4_4, PFNGLBINDBUFFERSBASEPROC, BindBuffersBase, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers), (target, first, count, buffers))
+GLAD_PROC_VOID(VERSION_4_4, PFNGLBINDBUFFERSRANGEPROC, BindBuffersRange, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes), (target, first, count, buffers, offsets, sizes))
+GLAD_PROC_VOID(VERSION_4_4, PFNGLBINDTEXTURESPROC, BindTextures, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures))
+GLAD_PROC_VOID(VERSION_4_4, PFNGLBINDSAMPLERSPROC, BindSamplers, (GLuint first, GLsizei count, const GLuint *samplers), (first, count, samplers))
+GLAD_PROC_VOID(VERSION_4_4, PFNGLBINDIMAGETEXTURESPROC, BindImageTextures, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures))
+GLAD_PROC_VOID(VERSION_4_4, PFNGLBINDVERTEXBUFFERSPROC, BindVertexBuffers, (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (first, count, buffers, offsets, strides))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCLIPCONTROLPROC, ClipControl, (GLenum origin, GLenum depth), (origin, depth))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCREATETRANSFORMFEEDBACKSPROC, CreateTransformFeedbacks, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC, TransformFeedbackBufferBase, (GLuint xfb, GLuint index, GLuint buffer), (xfb, index, buffer))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC, TransformFeedbackBufferRange, (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (xfb, index, buffer, offset, size))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETTRANSFORMFEEDBACKIVPROC, GetTransformFeedbackiv, (GLuint xfb, GLenum pname, GLint *param), (xfb, pname, param))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETTRANSFORMFEEDBACKI_VPROC, GetTransformFeedbacki_v, (GLuint xfb, GLenum pname, GLuint index, GLint *param), (xfb, pname, index, param))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETTRANSFORMFEEDBACKI64_VPROC, GetTransformFeedbacki64_v, (GLuint xfb, GLenum pname, GLuint index, GLint64 *param), (xfb, pname, index, param))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCREATEBUFFERSPROC, CreateBuffers, (GLsizei n, GLuint *buffers), (n, buffers))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLNAMEDBUFFERSTORAGEPROC, NamedBufferStorage, (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags), (buffer, size, data, flags))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLNAMEDBUFFERDATAPROC, NamedBufferData, (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage), (buffer, size, data, usage))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLNAMEDBUFFERSUBDATAPROC, NamedBufferSubData, (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (buffer, offset, size, data))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCOPYNAMEDBUFFERSUBDATAPROC, CopyNamedBufferSubData, (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readBuffer, writeBuffer, readOffset, writeOffset, size))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCLEARNAMEDBUFFERDATAPROC, ClearNamedBufferData, (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data), (buffer, internalformat, format, type, data))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCLEARNAMEDBUFFERSUBDATAPROC, ClearNamedBufferSubData, (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (buffer, internalformat, offset, size, format, type, data))
+GLAD_PROC(VERSION_4_5, PFNGLMAPNAMEDBUFFERPROC, void *, MapNamedBuffer, (GLuint buffer, GLenum access), (buffer, access))
+GLAD_PROC(VERSION_4_5, PFNGLMAPNAMEDBUFFERRANGEPROC, void *, MapNamedBufferRange, (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access), (buffer, offset, length, access))
+GLAD_PROC(VERSION_4_5, PFNGLUNMAPNAMEDBUFFERPROC, GLboolean, UnmapNamedBuffer, (GLuint buffer), (buffer))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC, FlushMappedNamedBufferRange, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNAMEDBUFFERPARAMETERIVPROC, GetNamedBufferParameteriv, (GLuint buffer, GLenum pname, GLint *params), (buffer, pname, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNAMEDBUFFERPARAMETERI64VPROC, GetNamedBufferParameteri64v, (GLuint buffer, GLenum pname, GLint64 *params), (buffer, pname, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNAMEDBUFFERPOINTERVPROC, GetNamedBufferPointerv, (GLuint buffer, GLenum pname, void **params), (buffer, pname, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNAMEDBUFFERSUBDATAPROC, GetNamedBufferSubData, (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data), (buffer, offset, size, data))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCREATEFRAMEBUFFERSPROC, CreateFramebuffers, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC, NamedFramebufferRenderbuffer, (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (framebuffer, attachment, renderbuffertarget, renderbuffer))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC, NamedFramebufferParameteri, (GLuint framebuffer, GLenum pname, GLint param), (framebuffer, pname, param))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLNAMEDFRAMEBUFFERTEXTUREPROC, NamedFramebufferTexture, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level), (framebuffer, attachment, texture, level))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC, NamedFramebufferTextureLayer, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer), (framebuffer, attachment, texture, level, layer))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC, NamedFramebufferDrawBuffer, (GLuint framebuffer, GLenum buf), (framebuffer, buf))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC, NamedFramebufferDrawBuffers, (GLuint framebuffer, GLsizei n, const GLenum *bufs), (framebuffer, n, bufs))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC, NamedFramebufferReadBuffer, (GLuint framebuffer, GLenum src), (framebuffer, src))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC, InvalidateNamedFramebufferData, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments), (framebuffer, numAttachments, attachments))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC, InvalidateNamedFramebufferSubData, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (framebuffer, numAttachments, attachments, x, y, width, height))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCLEARNAMEDFRAMEBUFFERIVPROC, ClearNamedFramebufferiv, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value), (framebuffer, buffer, drawbuffer, value))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC, ClearNamedFramebufferuiv, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value), (framebuffer, buffer, drawbuffer, value))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCLEARNAMEDFRAMEBUFFERFVPROC, ClearNamedFramebufferfv, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value), (framebuffer, buffer, drawbuffer, value))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCLEARNAMEDFRAMEBUFFERFIPROC, ClearNamedFramebufferfi, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (framebuffer, buffer, drawbuffer, depth, stencil))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLBLITNAMEDFRAMEBUFFERPROC, BlitNamedFramebuffer, (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_PROC(VERSION_4_5, PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC, GLenum, CheckNamedFramebufferStatus, (GLuint framebuffer, GLenum target), (framebuffer, target))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC, GetNamedFramebufferParameteriv, (GLuint framebuffer, GLenum pname, GLint *param), (framebuffer, pname, param))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC, GetNamedFramebufferAttachmentParameteriv, (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params), (framebuffer, attachment, pname, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCREATERENDERBUFFERSPROC, CreateRenderbuffers, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLNAMEDRENDERBUFFERSTORAGEPROC, NamedRenderbufferStorage, (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, internalformat, width, height))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC, NamedRenderbufferStorageMultisample, (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, internalformat, width, height))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC, GetNamedRenderbufferParameteriv, (GLuint renderbuffer, GLenum pname, GLint *params), (renderbuffer, pname, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCREATETEXTURESPROC, CreateTextures, (GLenum target, GLsizei n, GLuint *textures), (target, n, textures))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTUREBUFFERPROC, TextureBuffer, (GLuint texture, GLenum internalformat, GLuint buffer), (texture, internalformat, buffer))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTUREBUFFERRANGEPROC, TextureBufferRange, (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (texture, internalformat, buffer, offset, size))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTURESTORAGE1DPROC, TextureStorage1D, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width), (texture, levels, internalformat, width))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTURESTORAGE2DPROC, TextureStorage2D, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (texture, levels, internalformat, width, height))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTURESTORAGE3DPROC, TextureStorage3D, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (texture, levels, internalformat, width, height, depth))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC, TextureStorage2DMultisample, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC, TextureStorage3DMultisample, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTURESUBIMAGE1DPROC, TextureSubImage1D, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, width, format, type, pixels))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTURESUBIMAGE2DPROC, TextureSubImage2D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTURESUBIMAGE3DPROC, TextureSubImage3D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC, CompressedTextureSubImage1D, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, width, format, imageSize, data))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC, CompressedTextureSubImage2D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, width, height, format, imageSize, data))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC, CompressedTextureSubImage3D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCOPYTEXTURESUBIMAGE1DPROC, CopyTextureSubImage1D, (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texture, level, xoffset, x, y, width))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCOPYTEXTURESUBIMAGE2DPROC, CopyTextureSubImage2D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, x, y, width, height))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCOPYTEXTURESUBIMAGE3DPROC, CopyTextureSubImage3D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTUREPARAMETERFPROC, TextureParameterf, (GLuint texture, GLenum pname, GLfloat param), (texture, pname, param))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTUREPARAMETERFVPROC, TextureParameterfv, (GLuint texture, GLenum pname, const GLfloat *param), (texture, pname, param))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTUREPARAMETERIPROC, TextureParameteri, (GLuint texture, GLenum pname, GLint param), (texture, pname, param))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTUREPARAMETERIIVPROC, TextureParameterIiv, (GLuint texture, GLenum pname, const GLint *params), (texture, pname, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTUREPARAMETERIUIVPROC, TextureParameterIuiv, (GLuint texture, GLenum pname, const GLuint *params), (texture, pname, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTUREPARAMETERIVPROC, TextureParameteriv, (GLuint texture, GLenum pname, const GLint *param), (texture, pname, param))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGENERATETEXTUREMIPMAPPROC, GenerateTextureMipmap, (GLuint texture), (texture))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLBINDTEXTUREUNITPROC, BindTextureUnit, (GLuint unit, GLuint texture), (unit, texture))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETTEXTUREIMAGEPROC, GetTextureImage, (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, format, type, bufSize, pixels))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC, GetCompressedTextureImage, (GLuint texture, GLint level, GLsizei bufSize, void *pixels), (texture, level, bufSize, pixels))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETTEXTURELEVELPARAMETERFVPROC, GetTextureLevelParameterfv, (GLuint texture, GLint level, GLenum pname, GLfloat *params), (texture, level, pname, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETTEXTURELEVELPARAMETERIVPROC, GetTextureLevelParameteriv, (GLuint texture, GLint level, GLenum pname, GLint *params), (texture, level, pname, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETTEXTUREPARAMETERFVPROC, GetTextureParameterfv, (GLuint texture, GLenum pname, GLfloat *params), (texture, pname, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETTEXTUREPARAMETERIIVPROC, GetTextureParameterIiv, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETTEXTUREPARAMETERIUIVPROC, GetTextureParameterIuiv, (GLuint texture, GLenum pname, GLuint *params), (texture, pname, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETTEXTUREPARAMETERIVPROC, GetTextureParameteriv, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCREATEVERTEXARRAYSPROC, CreateVertexArrays, (GLsizei n, GLuint *arrays), (n, arrays))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLDISABLEVERTEXARRAYATTRIBPROC, DisableVertexArrayAttrib, (GLuint vaobj, GLuint index), (vaobj, index))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLENABLEVERTEXARRAYATTRIBPROC, EnableVertexArrayAttrib, (GLuint vaobj, GLuint index), (vaobj, index))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLVERTEXARRAYELEMENTBUFFERPROC, VertexArrayElementBuffer, (GLuint vaobj, GLuint buffer), (vaobj, buffer))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLVERTEXARRAYVERTEXBUFFERPROC, VertexArrayVertexBuffer, (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (vaobj, bindingindex, buffer, offset, stride))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLVERTEXARRAYVERTEXBUFFERSPROC, VertexArrayVertexBuffers, (GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (vaobj, first, count, buffers, offsets, strides))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLVERTEXARRAYATTRIBBINDINGPROC, VertexArrayAttribBinding, (GLuint vaobj, GLuint attribindex, GLuint bindingindex), (vaobj, attribindex, bindingindex))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLVERTEXARRAYATTRIBFORMATPROC, VertexArrayAttribFormat, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (vaobj, attribindex, size, type, normalized, relativeoffset))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLVERTEXARRAYATTRIBIFORMATPROC, VertexArrayAttribIFormat, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLVERTEXARRAYATTRIBLFORMATPROC, VertexArrayAttribLFormat, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLVERTEXARRAYBINDINGDIVISORPROC, VertexArrayBindingDivisor, (GLuint vaobj, GLuint bindingindex, GLuint divisor), (vaobj, bindingindex, divisor))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETVERTEXARRAYIVPROC, GetVertexArrayiv, (GLuint vaobj, GLenum pname, GLint *param), (vaobj, pname, param))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETVERTEXARRAYINDEXEDIVPROC, GetVertexArrayIndexediv, (GLuint vaobj, GLuint index, GLenum pname, GLint *param), (vaobj, index, pname, param))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETVERTEXARRAYINDEXED64IVPROC, GetVertexArrayIndexed64iv, (GLuint vaobj, GLuint index, GLenum pname, GLint64 *param), (vaobj, index, pname, param))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCREATESAMPLERSPROC, CreateSamplers, (GLsizei n, GLuint *samplers), (n, samplers))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCREATEPROGRAMPIPELINESPROC, CreateProgramPipelines, (GLsizei n, GLuint *pipelines), (n, pipelines))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLCREATEQUERIESPROC, CreateQueries, (GLenum target, GLsizei n, GLuint *ids), (target, n, ids))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETQUERYBUFFEROBJECTI64VPROC, GetQueryBufferObjecti64v, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETQUERYBUFFEROBJECTIVPROC, GetQueryBufferObjectiv, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETQUERYBUFFEROBJECTUI64VPROC, GetQueryBufferObjectui64v, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETQUERYBUFFEROBJECTUIVPROC, GetQueryBufferObjectuiv, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLMEMORYBARRIERBYREGIONPROC, MemoryBarrierByRegion, (GLbitfield barriers), (barriers))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETTEXTURESUBIMAGEPROC, GetTextureSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC, GetCompressedTextureSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels))
+GLAD_PROC(VERSION_4_5, PFNGLGETGRAPHICSRESETSTATUSPROC, GLenum, GetGraphicsResetStatus, (void), ())
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNCOMPRESSEDTEXIMAGEPROC, GetnCompressedTexImage, (GLenum target, GLint lod, GLsizei bufSize, void *pixels), (target, lod, bufSize, pixels))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNTEXIMAGEPROC, GetnTexImage, (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (target, level, format, type, bufSize, pixels))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNUNIFORMDVPROC, GetnUniformdv, (GLuint program, GLint location, GLsizei bufSize, GLdouble *params), (program, location, bufSize, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNUNIFORMFVPROC, GetnUniformfv, (GLuint program, GLint location, GLsizei bufSize, GLfloat *params), (program, location, bufSize, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNUNIFORMIVPROC, GetnUniformiv, (GLuint program, GLint location, GLsizei bufSize, GLint *params), (program, location, bufSize, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNUNIFORMUIVPROC, GetnUniformuiv, (GLuint program, GLint location, GLsizei bufSize, GLuint *params), (program, location, bufSize, params))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLREADNPIXELSPROC, ReadnPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data), (x, y, width, height, format, type, bufSize, data))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNMAPDVPROC, GetnMapdv, (GLenum target, GLenum query, GLsizei bufSize, GLdouble *v), (target, query, bufSize, v))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNMAPFVPROC, GetnMapfv, (GLenum target, GLenum query, GLsizei bufSize, GLfloat *v), (target, query, bufSize, v))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNMAPIVPROC, GetnMapiv, (GLenum target, GLenum query, GLsizei bufSize, GLint *v), (target, query, bufSize, v))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNPIXELMAPFVPROC, GetnPixelMapfv, (GLenum map, GLsizei bufSize, GLfloat *values), (map, bufSize, values))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNPIXELMAPUIVPROC, GetnPixelMapuiv, (GLenum map, GLsizei bufSize, GLuint *values), (map, bufSize, values))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNPIXELMAPUSVPROC, GetnPixelMapusv, (GLenum map, GLsizei bufSize, GLushort *values), (map, bufSize, values))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNPOLYGONSTIPPLEPROC, GetnPolygonStipple, (GLsizei bufSize, GLubyte *pattern), (bufSize, pattern))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNCOLORTABLEPROC, GetnColorTable, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table), (target, format, type, bufSize, table))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNCONVOLUTIONFILTERPROC, GetnConvolutionFilter, (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image), (target, format, type, bufSize, image))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNSEPARABLEFILTERPROC, GetnSeparableFilter, (GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span), (target, format, type, rowBufSize, row, columnBufSize, column, span))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNHISTOGRAMPROC, GetnHistogram, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLGETNMINMAXPROC, GetnMinmax, (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values), (target, reset, format, type, bufSize, values))
+GLAD_PROC_VOID(VERSION_4_5, PFNGLTEXTUREBARRIERPROC, TextureBarrier, (void), ())
+GLAD_PROC_VOID(VERSION_4_6, PFNGLSPECIALIZESHADERPROC, SpecializeShader, (GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue), (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue))
+GLAD_PROC_VOID(VERSION_4_6, PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC, MultiDrawArraysIndirectCount, (GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, indirect, drawcount, maxdrawcount, stride))
+GLAD_PROC_VOID(VERSION_4_6, PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC, MultiDrawElementsIndirectCount, (GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, type, indirect, drawcount, maxdrawcount, stride))
+GLAD_PROC_VOID(VERSION_4_6, PFNGLPOLYGONOFFSETCLAMPPROC, PolygonOffsetClamp, (GLfloat factor, GLfloat units, GLfloat clamp), (factor, units, clamp))
+
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
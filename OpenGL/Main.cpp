@@ -1,11 +1,51 @@
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
+#include "AssetLoader.h"
+#include "Context.h"
+#include "DebugOutput.h"
+#include "FramePipeline.h"
+#include "FrameStats.h"
+#include "GLTrace.h"
+#include "GLObjects.h"
+#include "GpuTimer.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include "ProgramCache.h"
+#include "RenderQueue.h"
+#include "RenderState.h"
+#include "ShaderManager.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <string>
+#include <vector>
+
+// DEMO OPTIONS
+// ------------
+struct DemoOptions
+{
+	ContextOptions context{};
+	std::string programCacheDirectory{ "shader_cache" }; // empty disables the program binary cache
+	std::string profilePath{};                           // Chrome trace written at exit, empty disables profiling
+	bool gpuTimes{ false };                              // per pass GPU times printed at exit (also on with profilePath)
+	std::string statsPath{};                             // per frame counters written as CSV at exit, empty disables them
+	std::string tracePath{};                             // GL call trace for the Replay tool, needs an ENGINE_GL_TRACE build
+	int pipelineDepth{ 0 };                              // frames simulated ahead on a separate thread, 0 runs everything in turn
+	std::vector<std::string> assetPaths{};               // textures (.ppm/.pgm) and meshes (.obj) streamed in while rendering
+};
+
+// FRAME DATA
+// ----------
+// Everything the simulation hands to the renderer for one frame, one per
+// pipeline slot.
+struct FrameData
+{
+	RenderQueue queue{};
+};
 
 // FORWARD DECLARATIONS
 // --------------------
-void framebuffer_size_callback(GLFWwindow* window, int width, int height);
-void processInput(GLFWwindow* window);
+bool parseArguments(int argc, char* argv[], DemoOptions& options);
+void simulateFrame(FrameData& frame, unsigned int program, unsigned int vertexArray);
 
 // SHADER SOURCE CODE
 // ------------------
@@ -23,71 +63,28 @@ const char* fragmentShaderSource = "#version 330 core\n"
 "}\n\0";
 // MAIN
 // ----
-int main()
+int main(int argc, char* argv[])
 {
-	// GLFW INITIALIZATION AND WINDOW CREATION
-	// ---------------------------------------
-	glfwInit();
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-	GLFWwindow* window{ glfwCreateWindow(800,800, "This is going to be an epic demo :D", NULL, NULL) };
-	if (window == NULL)
-	{
-		std::cout << "Window failed to create" << std::endl;
-		glfwTerminate();
+	// CONTEXT CREATION (GLFW WINDOW OR HEADLESS EGL)
+	// ----------------------------------------------
+	DemoOptions options{};
+	if (!parseArguments(argc, argv, options))
 		return -1;
-	}
-	glfwMakeContextCurrent(window);
-	glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
-	// LOAD OPENGL FUNCITON POINTERS
-	// -----------------------------
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
-	{
-		std::cout << "Failed to load OpenGL function pointers" << std::endl;
+	Profiler::setEnabled(!options.profilePath.empty());
+	Profiler::setThreadName("Main");
+	Context context{};
+	if (!context.create(options.context))
 		return -1;
-	}
-	// INITIALIZE VERTEX SHADER
-	// ------------------------
-	unsigned int vertexShader{ glCreateShader(GL_VERTEX_SHADER) };
-	glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-	glCompileShader(vertexShader);
-
-	int success;
-	char infoLog[512];
-	glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-	if (!success)
-	{
-		glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-		std::cout << "Vertex shader compilation failed" << infoLog << std::endl;
-	}
-	// INITIALIZE FRAGMENT SHADER
-	// --------------------------
-	unsigned int fragmentShader{ glCreateShader(GL_FRAGMENT_SHADER) };
-	glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-	glCompileShader(fragmentShader);
-	glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-	if (!success)
-	{
-		glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-		std::cout << "Fragment shader compilation failed" << infoLog << std::endl;
-	}
-	// LINK SHADERS
-	// ------------
-	unsigned int shaderProgram{ glCreateProgram() };
-	glAttachShader(shaderProgram, vertexShader);
-	glAttachShader(shaderProgram, fragmentShader);
-	glLinkProgram(shaderProgram);
-	// CHECK PROGRAM LINK SUCCESS
-	// --------------------------
-	glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-	if (!success)
-	{
-		glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-		std::cout << "Failed to link shader program" << infoLog << std::endl;
-	}
-	glDeleteShader(vertexShader);
-	glDeleteShader(fragmentShader);
+	if (!options.tracePath.empty())
+		GLTrace::begin(options.tracePath);
+	DebugOutput debugOutput{};
+	if (options.context.debugContext)
+		debugOutput.create();
+	// SUBMIT SHADER PROGRAMS (CACHED BINARIES OR ASYNC COMPILES, NOTHING WAITS HERE)
+	// ------------------------------------------------------------------------------
+	ProgramCache programCache{ options.programCacheDirectory };
+	ShaderManager shaders{ context.loader(), &programCache };
+	int triangleShader{ shaders.add("triangle", vertexShaderSource, fragmentShaderSource) };
 	// INITIALIZE VERTEX DATA
 	// ----------------------
 	GLfloat vertices[]
@@ -98,58 +95,237 @@ int main()
 	};
 	// INITIALIZE VERTEX BUFFER OBJECT
 	// -------------------------------
-	unsigned int VBO, VAO;
-	glGenVertexArrays(1, &VAO);
-	glGenBuffers(1, &VBO);
-	// BIND VAO AND VBO TO PASS VERTEX DATA TO BUFFER OBJECT
-	// -----------------------------------------------------
-	glBindVertexArray(VAO);
-	glBindBuffer(GL_ARRAY_BUFFER, VBO);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-	// VERTEX ATTRIBUTE POINTER
-	// ------------------------
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(GL_FLOAT), (void*)0);
-	glEnableVertexAttribArray(0);
-	// UNBIND ARRAY BUFFER
-	// -------------------
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindVertexArray(0); // Binding array and buffer obects to 0 is to "unbind" them
+	Buffer VBO{};
+	VertexArray VAO{};
+	if (!VBO.create(sizeof(vertices), vertices) || !VAO.create())
+		return -1;
+	// ATTACH THE BUFFER AND DESCRIBE THE VERTEX LAYOUT (DSA, NOTHING GETS BOUND)
+	// -------------------------------------------------------------------------
+	VAO.setVertexBuffer(0, VBO, 0, 3 * sizeof(GL_FLOAT));
+	VAO.setAttribute(0, 0, 3, GL_FLOAT, false, 0);
+	// WAIT FOR THE SHADER PROGRAM NOW THAT IT IS NEEDED
+	// -------------------------------------------------
+	unsigned int shaderProgram{ shaders.program(triangleShader) };
+	if (shaderProgram == 0)
+		std::cout << "Failed to build shader program" << std::endl;
+	shaders.printStats();
+	programCache.printStats();
+	// START STREAMING ASSETS (DECODED BY JOBS, UPLOADED OFF THE RENDER THREAD)
+	// ------------------------------------------------------------------------
+	JobSystem jobs{};
+	AssetLoader assets{};
+	if (!options.assetPaths.empty() && jobs.create() && assets.create(context, jobs))
+	{
+		for (const std::string& path : options.assetPaths)
+		{
+			bool mesh{ path.size() > 4 && path.compare(path.size() - 4, 4, ".obj") == 0 };
+			if (mesh)
+				assets.loadMesh(path);
+			else
+				assets.loadTexture(path);
+		}
+	}
 	// RENDER LOOP
 	// -----------
-	while (!glfwWindowShouldClose(window))
+	RenderStateCache renderState{};
+	std::vector<FrameData> frames(options.pipelineDepth > 0 ? options.pipelineDepth : 1);
+	FramePipeline pipeline{};
+	if (options.pipelineDepth > 0)
 	{
+		unsigned int vertexArray{ VAO.id() };
+		pipeline.create(options.pipelineDepth, [&frames, shaderProgram, vertexArray](int slot, long long)
+		{
+			simulateFrame(frames[slot], shaderProgram, vertexArray);
+		});
+	}
+	GpuTimer gpuTimer{};
+	FrameStats frameStats{};
+	bool collectStats{ !options.statsPath.empty() };
+	if (options.gpuTimes || !options.profilePath.empty())
+		gpuTimer.create();
+	auto loopStart{ std::chrono::steady_clock::now() };
+	while (!context.shouldClose())
+	{
+		PROFILE_SCOPE("Frame");
+		// TAKE THE FRAME THE SIMULATION THREAD PREPARED
+		// ---------------------------------------------
+		// Before anything starts the frame, so leaving here leaves nothing half begun
+		int slot{ 0 };
+		if (options.pipelineDepth > 0)
+		{
+			slot = pipeline.beginRender();
+			if (slot < 0)
+				break;
+		}
+		renderState.beginFrame();
+		gpuTimer.beginFrame();
+		if (collectStats)
+			frameStats.beginFrame();
 		// INPUT
 		// -----
-		processInput(window);
+		{
+			PROFILE_SCOPE("Input");
+			context.processInput();
+		}
+		assets.poll();
+		// OR SIMULATE IT HERE, UNDER THE SAME PROFILER ZONE AS THE SIMULATION THREAD
+		// --------------------------------------------------------------------------
+		if (options.pipelineDepth == 0)
+		{
+			PROFILE_SCOPE("Simulate");
+			simulateFrame(frames[0], shaderProgram, VAO.id());
+		}
 		// RENDER COLORED BACKGROUND
 		// -------------------------
-		glClearColor(0.0f, 0.0f, 0.1f, 1.0f);
-		glClear(GL_COLOR_BUFFER_BIT);
-		// DRAW SOME TRIANGLES MF
-		// -------------------------
-		glUseProgram(shaderProgram);
-		glBindVertexArray(VAO);
-		glDrawArrays(GL_TRIANGLES, 0, 3);
+		{
+			PROFILE_SCOPE("Render submission");
+			{
+				GPU_PROFILE_SCOPE(gpuTimer, "Clear");
+				glClearColor(0.0f, 0.0f, 0.1f, 1.0f);
+				glClear(GL_COLOR_BUFFER_BIT);
+			}
+			// DRAW SOME TRIANGLES MF
+			// -------------------------
+			GPU_PROFILE_SCOPE(gpuTimer, "Draw");
+			frames[slot].queue.flush(renderState);
+		}
+		gpuTimer.endFrame();
 		// GLFW SWAP BUFFERS AND POLL EVENTS (MOUSE MOVEMENT, KEYBOARD, ETC.)
 		// ------------------------------------------------------------------
-		glfwSwapBuffers(window);
-		glfwPollEvents();
+		{
+			PROFILE_SCOPE("Swap buffers");
+			context.swapBuffers();
+		}
+		if (options.pipelineDepth > 0)
+			pipeline.endRender(slot);
+		{
+			PROFILE_SCOPE("Poll events");
+			context.pollEvents();
+		}
+		if (collectStats)
+			frameStats.endFrame(renderState);
+	}
+	pipeline.destroy();
+	// REPORT HEADLESS THROUGHPUT
+	// --------------------------
+	if (context.isHeadless())
+	{
+		glFinish();
+		double seconds{ std::chrono::duration<double>(std::chrono::steady_clock::now() - loopStart).count() };
+		std::cout << "Rendered " << context.frameCount() << " frames in " << seconds * 1000.0 << " ms ("
+			<< context.frameCount() / seconds << " fps)" << std::endl;
+	}
+	// REPORT REDUNDANT STATE CHANGES THE CACHE SKIPPED
+	// ------------------------------------------------
+	std::cout << "Render state: " << renderState.total().issued << " calls issued, " << renderState.total().elided
+		<< " elided (" << renderState.frame().elided << " in the last frame)" << std::endl;
+	gpuTimer.printStats();
+	pipeline.printStats();
+	if (!options.assetPaths.empty())
+		assets.printStats();
+	if (collectStats)
+	{
+		frameStats.print();
+		frameStats.writeCsv(options.statsPath);
 	}
+	if (options.context.debugContext)
+		debugOutput.printStats();
+	// WRITE THE PROFILE
+	// -----------------
+	if (!options.profilePath.empty())
+		Profiler::writeChromeTrace(options.profilePath);
 	// DE-ALLOCATE RESOURCES
 	// ---------------------
-	glDeleteVertexArrays(1, &VAO);
-	glDeleteBuffers(1, &VBO);
-	glDeleteProgram(shaderProgram);
-	glfwTerminate();
+	assets.destroy();
+	jobs.destroy();
+	shaders.destroy();
+	gpuTimer.destroy();
+	debugOutput.destroy();
+	VAO.destroy();
+	VBO.destroy();
+	GLTrace::end();
+	context.destroy();
 }
-// PROCESSINPUT() AND FRAMEBUFFER_SIZE_CALLBACK IMPLEMENTATIONS
-// ------------------------------------------------------------
-void processInput(GLFWwindow* window)
+// SIMULATEFRAME() IMPLEMENTATION
+// -------------------------------
+// Builds the frame's sorted draw list; no GL calls, so it can run on the
+// simulation thread.
+void simulateFrame(FrameData& frame, unsigned int program, unsigned int vertexArray)
 {
-	if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
-		glfwSetWindowShouldClose(window, true);
+	DrawItem triangle{};
+	triangle.key = makeSortKey(0, program, 0, vertexArray, 0.5f);
+	triangle.program = program;
+	triangle.vertexArray = vertexArray;
+	triangle.count = 3;
+	frame.queue.submit(triangle);
+	frame.queue.sort();
 }
-void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+// PARSEARGUMENTS() IMPLEMENTATION
+// -------------------------------
+// --headless           render offscreen through EGL instead of opening a window
+// --frames <count>     stop after <count> frames (headless defaults to DEFAULT_HEADLESS_FRAMES)
+// --size <w> <h>       window or offscreen framebuffer size
+// --lazy-gl            resolve GL functions on first call instead of at startup
+// --program-cache <d>  directory for cached program binaries ("shader_cache")
+// --no-program-cache   always compile shaders from source
+// --profile <file>     record CPU and GPU zones and write them as Chrome trace JSON at exit
+// --gpu-times          print per pass GPU times from timer queries at exit
+// --gl-debug           debug context with KHR_debug messages filtered, deduplicated and logged
+// --trace <file>       record every GL call for the Replay tool (ENGINE_GL_TRACE builds)
+// --stats <file>       count draws, triangles, state changes, uploads and GL errors per frame,
+//                      print min/avg/p99/max at exit and write every frame as CSV
+// --pipeline <depth>   simulate up to <depth> frames ahead on a separate thread while the
+//                      main thread renders, latency printed at exit
+// --load <file>        stream a texture (.ppm/.pgm) or mesh (.obj) in while rendering, repeatable,
+//                      not together with --trace (only the main context is traced)
+bool parseArguments(int argc, char* argv[], DemoOptions& options)
 {
-	glViewport(0, 0, width, height);
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--headless") == 0)
+			options.context.backend = ContextBackend::Headless;
+		else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			options.context.frameLimit = std::atoi(argv[++i]);
+		else if (std::strcmp(argv[i], "--lazy-gl") == 0)
+			options.context.lazyLoading = true;
+		else if (std::strcmp(argv[i], "--size") == 0 && i + 2 < argc)
+		{
+			options.context.width = std::atoi(argv[++i]);
+			options.context.height = std::atoi(argv[++i]);
+		}
+		else if (std::strcmp(argv[i], "--program-cache") == 0 && i + 1 < argc)
+			options.programCacheDirectory = argv[++i];
+		else if (std::strcmp(argv[i], "--no-program-cache") == 0)
+			options.programCacheDirectory.clear();
+		else if (std::strcmp(argv[i], "--profile") == 0 && i + 1 < argc)
+			options.profilePath = argv[++i];
+		else if (std::strcmp(argv[i], "--gpu-times") == 0)
+			options.gpuTimes = true;
+		else if (std::strcmp(argv[i], "--gl-debug") == 0)
+			options.context.debugContext = true;
+		else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+			options.tracePath = argv[++i];
+		else if (std::strcmp(argv[i], "--stats") == 0 && i + 1 < argc)
+			options.statsPath = argv[++i];
+		else if (std::strcmp(argv[i], "--pipeline") == 0 && i + 1 < argc)
+			options.pipelineDepth = std::atoi(argv[++i]);
+		else if (std::strcmp(argv[i], "--load") == 0 && i + 1 < argc)
+			options.assetPaths.push_back(argv[++i]);
+		else
+		{
+			std::cout << "Unknown argument " << argv[i] << std::endl;
+			std::cout << "Usage: OpenGL [--headless] [--frames <count>] [--size <width> <height>] [--lazy-gl]" << std::endl;
+			std::cout << "              [--program-cache <directory>] [--no-program-cache] [--profile <file>] [--gpu-times]" << std::endl;
+			std::cout << "              [--stats <file>] [--gl-debug] [--trace <file>] [--pipeline <depth>]" << std::endl;
+			std::cout << "              [--load <file>]..." << std::endl;
+			return false;
+		}
+	}
+	// Tracing refuses the shared upload context, the assets would never load
+	if (!options.tracePath.empty() && !options.assetPaths.empty())
+	{
+		std::cout << "--load can not be combined with --trace, only the main context is traced" << std::endl;
+		return false;
+	}
+	return true;
 }
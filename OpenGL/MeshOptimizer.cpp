@@ -0,0 +1,324 @@
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+// DEDUPLICATION
+// -------------
+// Open addressing over vertex indices, hashing the vertex's bytes (FNV-1a)
+static std::uint64_t hashVertex(const float* vertex, int floatsPerVertex)
+{
+	const unsigned char* bytes{ (const unsigned char*)vertex };
+	std::uint64_t hash{ 14695981039346656037ull };
+	for (std::size_t i{ 0 }; i < floatsPerVertex * sizeof(float); ++i)
+	{
+		hash ^= bytes[i];
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+void deduplicateVertices(IndexedMesh& mesh)
+{
+	std::uint32_t vertexCount{ mesh.vertexCount() };
+	int stride{ mesh.floatsPerVertex };
+	std::size_t tableSize{ 1 };
+	while (tableSize < vertexCount * 2u)
+		tableSize *= 2;
+	const std::uint32_t EMPTY{ 0xFFFFFFFFu };
+	std::vector<std::uint32_t> table(tableSize, EMPTY);
+	std::vector<std::uint32_t> remap(vertexCount);
+	std::vector<float> unique{};
+	unique.reserve(mesh.vertices.size());
+
+	for (std::uint32_t v{ 0 }; v < vertexCount; ++v)
+	{
+		const float* vertex{ &mesh.vertices[(std::size_t)v * stride] };
+		std::size_t slot{ hashVertex(vertex, stride) & (tableSize - 1) };
+		while (table[slot] != EMPTY && std::memcmp(&unique[(std::size_t)table[slot] * stride], vertex, stride * sizeof(float)) != 0)
+			slot = (slot + 1) & (tableSize - 1);
+		if (table[slot] == EMPTY)
+		{
+			table[slot] = (std::uint32_t)(unique.size() / stride);
+			unique.insert(unique.end(), vertex, vertex + stride);
+		}
+		remap[v] = table[slot];
+	}
+	for (std::uint32_t& index : mesh.indices)
+		index = remap[index];
+	mesh.vertices.swap(unique);
+}
+IndexedMesh indexTriangles(const float* vertices, std::uint32_t vertexCount, int floatsPerVertex)
+{
+	IndexedMesh mesh{};
+	mesh.floatsPerVertex = floatsPerVertex;
+	mesh.vertices.assign(vertices, vertices + (std::size_t)vertexCount * floatsPerVertex);
+	mesh.indices.resize(vertexCount - vertexCount % 3);
+	for (std::uint32_t i{ 0 }; i < mesh.indices.size(); ++i)
+		mesh.indices[i] = i;
+	deduplicateVertices(mesh);
+	return mesh;
+}
+// VERTEX CACHE ANALYSIS
+// ---------------------
+// A vertex is in a FIFO of size k exactly when fewer than k misses happened
+// since it was loaded, so a per-vertex "loaded at miss number" stamp suffices.
+VertexCacheStats analyzeVertexCache(const IndexedMesh& mesh, int cacheSize)
+{
+	VertexCacheStats stats{};
+	std::uint32_t vertexCount{ mesh.vertexCount() };
+	std::vector<std::uint32_t> loadedAt(vertexCount, 0);
+	std::uint32_t misses{ 0 };
+	for (std::uint32_t index : mesh.indices)
+	{
+		// Stamps are misses + 1 so 0 means never loaded
+		if (loadedAt[index] == 0 || misses + 1 - loadedAt[index] >= (std::uint32_t)cacheSize)
+			loadedAt[index] = ++misses + 1;
+	}
+	stats.transformed = misses;
+	if (mesh.triangleCount() > 0)
+		stats.acmr = (float)misses / (float)mesh.triangleCount();
+	if (vertexCount > 0)
+		stats.atvr = (float)misses / (float)vertexCount;
+	return stats;
+}
+// TIPSY
+// -----
+// Emits all remaining triangles around a fanning vertex, then picks the next
+// fanning vertex among the ones just referenced: the oldest one that will
+// still be cached after its remaining triangles are emitted. Dead ends fall
+// back to recently used vertices (a stack), then to a cursor over all vertices.
+void optimizeVertexCache(IndexedMesh& mesh, int cacheSize)
+{
+	std::uint32_t vertexCount{ mesh.vertexCount() };
+	std::uint32_t triangleCount{ mesh.triangleCount() };
+	if (triangleCount == 0)
+		return;
+	// Vertex to triangle adjacency, compressed: triangles of v are adjacency[offsets[v]..offsets[v + 1])
+	std::vector<std::uint32_t> live(vertexCount, 0);
+	for (std::uint32_t i{ 0 }; i < triangleCount * 3; ++i)
+		++live[mesh.indices[i]];
+	std::vector<std::uint32_t> offsets(vertexCount + 1, 0);
+	for (std::uint32_t v{ 0 }; v < vertexCount; ++v)
+		offsets[v + 1] = offsets[v] + live[v];
+	std::vector<std::uint32_t> adjacency(triangleCount * 3);
+	std::vector<std::uint32_t> fill(offsets.begin(), offsets.end() - 1);
+	for (std::uint32_t i{ 0 }; i < triangleCount * 3; ++i)
+		adjacency[fill[mesh.indices[i]]++] = i / 3;
+
+	std::vector<std::uint32_t> cachedAt(vertexCount, 0);
+	std::vector<bool> emitted(triangleCount, false);
+	std::vector<std::uint32_t> deadEnds{};
+	std::vector<std::uint32_t> candidates{};
+	std::vector<std::uint32_t> output{};
+	output.reserve(mesh.indices.size());
+	std::uint32_t time{ (std::uint32_t)cacheSize + 1 };
+	std::uint32_t cursor{ 0 };
+	std::int64_t fan{ 0 };
+
+	while (fan >= 0)
+	{
+		candidates.clear();
+		for (std::uint32_t a{ offsets[fan] }; a < offsets[fan + 1]; ++a)
+		{
+			std::uint32_t triangle{ adjacency[a] };
+			if (emitted[triangle])
+				continue;
+			emitted[triangle] = true;
+			for (int corner{ 0 }; corner < 3; ++corner)
+			{
+				std::uint32_t v{ mesh.indices[triangle * 3 + corner] };
+				output.push_back(v);
+				deadEnds.push_back(v);
+				candidates.push_back(v);
+				--live[v];
+				if (time - cachedAt[v] > (std::uint32_t)cacheSize)
+					cachedAt[v] = time++;
+			}
+		}
+		// Next fanning vertex
+		fan = -1;
+		std::int64_t best{ -1 };
+		for (std::uint32_t v : candidates)
+		{
+			if (live[v] == 0)
+				continue;
+			std::int64_t priority{ 0 };
+			if ((std::int64_t)time - cachedAt[v] + 2 * (std::int64_t)live[v] <= cacheSize)
+				priority = time - cachedAt[v];
+			if (priority > best)
+			{
+				best = priority;
+				fan = v;
+			}
+		}
+		if (fan >= 0)
+			continue;
+		while (!deadEnds.empty() && fan < 0)
+		{
+			std::uint32_t v{ deadEnds.back() };
+			deadEnds.pop_back();
+			if (live[v] > 0)
+				fan = v;
+		}
+		while (fan < 0 && cursor < vertexCount)
+		{
+			if (live[cursor] > 0)
+				fan = cursor;
+			++cursor;
+		}
+	}
+	mesh.indices.swap(output);
+}
+// OVERDRAW
+// --------
+void optimizeOverdraw(IndexedMesh& mesh, int cacheSize, float threshold)
+{
+	std::uint32_t triangleCount{ mesh.triangleCount() };
+	if (triangleCount == 0 || mesh.floatsPerVertex < 3)
+		return;
+	float meshAcmr{ analyzeVertexCache(mesh, cacheSize).acmr };
+
+	// Hard boundaries: triangles that miss on all three vertices, the cache
+	// order restarted there and cutting costs nothing
+	std::vector<bool> hardBoundary(triangleCount, false);
+	std::vector<std::uint32_t> loadedAt(mesh.vertexCount(), 0);
+	std::uint32_t misses{ 0 };
+	auto load{ [&](std::uint32_t v)
+	{
+		if (loadedAt[v] != 0 && misses + 1 - loadedAt[v] < (std::uint32_t)cacheSize)
+			return 0;
+		loadedAt[v] = ++misses + 1;
+		return 1;
+	} };
+	for (std::uint32_t t{ 0 }; t < triangleCount; ++t)
+	{
+		int triangleMisses{ 0 };
+		for (int corner{ 0 }; corner < 3; ++corner)
+			triangleMisses += load(mesh.indices[t * 3 + corner]);
+		hardBoundary[t] = t == 0 || triangleMisses == 3;
+	}
+	// Soft boundaries: once a cluster, simulated from an empty cache, is within
+	// threshold of the mesh's ACMR, the cache warmup after a cut is paid for
+	std::vector<std::uint32_t> clusters{};
+	std::uint32_t clusterStart{ 0 };
+	std::uint32_t clusterMisses{ 0 };
+	for (std::uint32_t t{ 0 }; t < triangleCount; ++t)
+	{
+		std::uint32_t clusterTriangles{ t - clusterStart };
+		bool efficient{ clusterTriangles > 0 && (float)clusterMisses / (float)clusterTriangles <= threshold * meshAcmr };
+		if (hardBoundary[t] || efficient)
+		{
+			clusters.push_back(t);
+			clusterStart = t;
+			clusterMisses = 0;
+			// Flush the simulated cache
+			misses += cacheSize;
+		}
+		for (int corner{ 0 }; corner < 3; ++corner)
+			clusterMisses += load(mesh.indices[t * 3 + corner]);
+	}
+	clusters.push_back(triangleCount);
+
+	// Mesh centroid, then each cluster's area weighted centroid and normal
+	int stride{ mesh.floatsPerVertex };
+	auto position{ [&](std::uint32_t index) { return &mesh.vertices[(std::size_t)mesh.indices[index] * stride]; } };
+	double center[3]{ 0.0, 0.0, 0.0 };
+	for (std::uint32_t v{ 0 }; v < mesh.vertexCount(); ++v)
+	{
+		for (int axis{ 0 }; axis < 3; ++axis)
+			center[axis] += mesh.vertices[(std::size_t)v * stride + axis];
+	}
+	for (double& axis : center)
+		axis /= mesh.vertexCount();
+
+	struct Cluster
+	{
+		std::uint32_t first;
+		std::uint32_t end;
+		double sortKey;
+	};
+	std::vector<Cluster> sorted{};
+	for (std::size_t c{ 0 }; c + 1 < clusters.size(); ++c)
+	{
+		double centroid[3]{ 0.0, 0.0, 0.0 };
+		double normal[3]{ 0.0, 0.0, 0.0 };
+		double area{ 0.0 };
+		for (std::uint32_t t{ clusters[c] }; t < clusters[c + 1]; ++t)
+		{
+			const float* p0{ position(t * 3) };
+			const float* p1{ position(t * 3 + 1) };
+			const float* p2{ position(t * 3 + 2) };
+			double e1[3]{ p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+			double e2[3]{ p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+			double n[3]{ e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+			double triangleArea{ std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]) };
+			for (int axis{ 0 }; axis < 3; ++axis)
+			{
+				centroid[axis] += (p0[axis] + p1[axis] + p2[axis]) / 3.0 * triangleArea;
+				normal[axis] += n[axis];
+			}
+			area += triangleArea;
+		}
+		double key{ 0.0 };
+		double normalLength{ std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]) };
+		if (area > 0.0 && normalLength > 0.0)
+		{
+			for (int axis{ 0 }; axis < 3; ++axis)
+				key += (centroid[axis] / area - center[axis]) * normal[axis] / normalLength;
+		}
+		sorted.push_back(Cluster{ clusters[c], clusters[c + 1], key });
+	}
+	// Clusters facing away from the center are in front from most directions, draw them first
+	std::stable_sort(sorted.begin(), sorted.end(), [](const Cluster& a, const Cluster& b) { return a.sortKey > b.sortKey; });
+
+	std::vector<std::uint32_t> output{};
+	output.reserve(mesh.indices.size());
+	for (const Cluster& cluster : sorted)
+		output.insert(output.end(), mesh.indices.begin() + cluster.first * 3, mesh.indices.begin() + cluster.end * 3);
+	mesh.indices.swap(output);
+}
+// VERTEX FETCH
+// ------------
+void optimizeVertexFetch(IndexedMesh& mesh)
+{
+	const std::uint32_t UNUSED{ 0xFFFFFFFFu };
+	int stride{ mesh.floatsPerVertex };
+	std::vector<std::uint32_t> remap(mesh.vertexCount(), UNUSED);
+	std::vector<float> ordered{};
+	ordered.reserve(mesh.vertices.size());
+	std::uint32_t next{ 0 };
+	for (std::uint32_t& index : mesh.indices)
+	{
+		if (remap[index] == UNUSED)
+		{
+			remap[index] = next++;
+			const float* vertex{ &mesh.vertices[(std::size_t)index * stride] };
+			ordered.insert(ordered.end(), vertex, vertex + stride);
+		}
+		index = remap[index];
+	}
+	// Vertices no triangle references are dropped
+	mesh.vertices.swap(ordered);
+}
+// FULL PIPELINE
+// -------------
+MeshOptimizationReport optimizeMesh(IndexedMesh& mesh, int cacheSize)
+{
+	MeshOptimizationReport report{};
+	report.inputVertices = mesh.vertexCount();
+	report.before = analyzeVertexCache(mesh, cacheSize);
+	deduplicateVertices(mesh);
+	optimizeVertexCache(mesh, cacheSize);
+	optimizeOverdraw(mesh, cacheSize);
+	optimizeVertexFetch(mesh);
+	report.uniqueVertices = mesh.vertexCount();
+	report.after = analyzeVertexCache(mesh, cacheSize);
+	return report;
+}
+void printReport(const MeshOptimizationReport& report)
+{
+	std::cout << "Mesh: " << report.inputVertices << " -> " << report.uniqueVertices << " vertices, ACMR "
+		<< report.before.acmr << " -> " << report.after.acmr << ", ATVR " << report.before.atvr << " -> "
+		<< report.after.atvr << std::endl;
+}
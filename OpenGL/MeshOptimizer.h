@@ -0,0 +1,62 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// INDEXED MESH
+// ------------
+// Interleaved float vertices, position (x, y, z) first, and a triangle list.
+struct IndexedMesh
+{
+	std::vector<float> vertices{};
+	std::vector<std::uint32_t> indices{};
+	int floatsPerVertex{ 3 };
+
+	std::uint32_t vertexCount() const { return floatsPerVertex > 0 ? (std::uint32_t)(vertices.size() / floatsPerVertex) : 0; }
+	std::uint32_t triangleCount() const { return (std::uint32_t)(indices.size() / 3); }
+};
+
+// Build an indexed mesh from a triangle soup (three vertices per triangle, as
+// passed to glDrawArrays), merging bitwise identical vertices
+IndexedMesh indexTriangles(const float* vertices, std::uint32_t vertexCount, int floatsPerVertex);
+// Merge bitwise identical vertices of an already indexed mesh
+void deduplicateVertices(IndexedMesh& mesh);
+
+// VERTEX CACHE ANALYSIS
+// ---------------------
+// Simulates a FIFO post-transform cache of cacheSize entries. ACMR is vertex
+// shader runs per triangle (0.5 is the ideal for large regular grids, 3 means
+// no reuse at all), ATVR is runs per unique vertex (1 is ideal).
+struct VertexCacheStats
+{
+	std::uint32_t transformed{ 0 };
+	float acmr{ 0.0f };
+	float atvr{ 0.0f };
+};
+VertexCacheStats analyzeVertexCache(const IndexedMesh& mesh, int cacheSize = 16);
+
+// OPTIMIZATION PASSES
+// -------------------
+// Run in this order; each keeps the mesh's geometry and only reorders.
+//
+// optimizeVertexCache: Tipsy (Sander, Nehab, Barczak 2007), fans triangles
+// around the vertex most likely to still be cached, linear in mesh size.
+void optimizeVertexCache(IndexedMesh& mesh, int cacheSize = 16);
+// optimizeOverdraw: splits the cache-ordered triangles into clusters at cache
+// restarts (and wherever a cluster's ACMR drops below threshold times the
+// mesh's), then draws outward facing clusters first so they occlude the rest.
+// threshold trades cache efficiency for less overdraw, 1.05 costs <= 5% ACMR.
+void optimizeOverdraw(IndexedMesh& mesh, int cacheSize = 16, float threshold = 1.05f);
+// optimizeVertexFetch: renumbers vertices in first-use order, so the vertex
+// fetch walks the buffer mostly sequentially.
+void optimizeVertexFetch(IndexedMesh& mesh);
+
+// Every pass, deduplication first; the report compares input and output
+struct MeshOptimizationReport
+{
+	std::uint32_t inputVertices{ 0 };
+	std::uint32_t uniqueVertices{ 0 };
+	VertexCacheStats before{};
+	VertexCacheStats after{};
+};
+MeshOptimizationReport optimizeMesh(IndexedMesh& mesh, int cacheSize = 16);
+void printReport(const MeshOptimizationReport& report);
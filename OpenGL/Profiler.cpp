@@ -0,0 +1,253 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+#if defined(_M_X64)
+#include <intrin.h>
+#define PROFILER_RDTSC
+#elif defined(__x86_64__)
+#include <x86intrin.h>
+#define PROFILER_RDTSC
+#endif
+
+struct ProfileEvent
+{
+	const char* name;
+	std::int64_t start;
+	std::int64_t end;
+};
+
+// One per thread that ever recorded a zone. Shared with the registry so the
+// events of threads that already exited can still be written out.
+struct ProfileThread
+{
+	std::vector<ProfileEvent> events;
+	std::atomic<std::uint64_t> written{ 0 };
+	std::string name;
+	int id;
+	bool exited{ false };
+};
+
+static std::atomic<bool> profilerEnabled{ false };
+static std::mutex registryMutex{};
+static std::vector<std::shared_ptr<ProfileThread>> registry{};
+// Ring buffers of exited threads, handed to the next thread that registers
+static std::vector<std::vector<ProfileEvent>> spareBuffers{};
+static int nextThreadId{ 1 };
+// A plain pointer keeps the per zone thread local access free of init guards,
+// the registry holds the owning reference
+static thread_local ProfileThread* localThread{ nullptr };
+
+static ProfileThread* registerThread(const char* name)
+{
+	std::shared_ptr<ProfileThread> thread{ std::make_shared<ProfileThread>() };
+	std::lock_guard<std::mutex> lock{ registryMutex };
+	if (!spareBuffers.empty())
+	{
+		thread->events.swap(spareBuffers.back());
+		spareBuffers.pop_back();
+	}
+	else
+		thread->events.resize(PROFILER_EVENTS_PER_THREAD);
+	thread->id = nextThreadId++;
+	thread->name = name != nullptr ? name : "Thread " + std::to_string(thread->id);
+	registry.push_back(thread);
+	return thread.get();
+}
+// The zones a thread or track recorded move into a buffer of their own size,
+// which stays for export until clear(), and the ring buffer goes back to the
+// spares. Without this every thread pool create/destroy cycle would leave
+// PROFILER_EVENTS_PER_THREAD events behind per thread.
+static void retireThread(ProfileThread* thread)
+{
+	std::shared_ptr<ProfileThread> retired{ std::make_shared<ProfileThread>() };
+	std::uint64_t written{ thread->written.load(std::memory_order_acquire) };
+	std::uint64_t oldest{ written > (std::uint64_t)PROFILER_EVENTS_PER_THREAD ? written - PROFILER_EVENTS_PER_THREAD : 0 };
+	retired->events.reserve((std::size_t)(written - oldest));
+	for (std::uint64_t i{ oldest }; i < written; ++i)
+		retired->events.push_back(thread->events[i % PROFILER_EVENTS_PER_THREAD]);
+	retired->written.store(retired->events.size(), std::memory_order_release);
+	retired->id = thread->id;
+	retired->exited = true;
+
+	std::lock_guard<std::mutex> lock{ registryMutex };
+	retired->name = thread->name;
+	for (auto entry{ registry.begin() }; entry != registry.end(); ++entry)
+	{
+		if (entry->get() != thread)
+			continue;
+		// An export that is still reading the ring buffer keeps it, it is freed instead of reused
+		if (entry->use_count() == 1)
+			spareBuffers.push_back(std::move(thread->events));
+		if (retired->events.empty())
+			registry.erase(entry);
+		else
+			*entry = retired;
+		break;
+	}
+}
+struct ProfileThreadExit
+{
+	~ProfileThreadExit()
+	{
+		if (localThread != nullptr)
+			retireThread(localThread);
+		localThread = nullptr;
+	}
+};
+static ProfileThread& currentThread()
+{
+	if (localThread == nullptr)
+	{
+		static thread_local ProfileThreadExit threadExit{};
+		localThread = registerThread(nullptr);
+	}
+	return *localThread;
+}
+// CLOCK
+// -----
+// Ticks are converted with the rate measured between startup and the export,
+// rdtsc is constant rate on every x86-64 CPU this engine targets.
+static std::int64_t steadyNanoseconds()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+static const std::int64_t epochTicks{ Profiler::timestamp() };
+static const std::int64_t epochNanoseconds{ steadyNanoseconds() };
+// RECORDING
+// ---------
+void Profiler::setEnabled(bool enabled)
+{
+	profilerEnabled.store(enabled, std::memory_order_relaxed);
+}
+bool Profiler::enabled()
+{
+	return profilerEnabled.load(std::memory_order_relaxed);
+}
+std::int64_t Profiler::timestamp()
+{
+#ifdef PROFILER_RDTSC
+	return (std::int64_t)__rdtsc();
+#else
+	return steadyNanoseconds();
+#endif
+}
+double Profiler::ticksPerNanosecond()
+{
+#ifdef PROFILER_RDTSC
+	std::int64_t ticks{ timestamp() - epochTicks };
+	std::int64_t nanoseconds{ steadyNanoseconds() - epochNanoseconds };
+	return nanoseconds > 0 ? (double)ticks / nanoseconds : 1.0;
+#else
+	return 1.0;
+#endif
+}
+void Profiler::record(const char* name, std::int64_t start, std::int64_t end)
+{
+	record(&currentThread(), name, start, end);
+}
+ProfileThread* Profiler::addTrack(const char* name)
+{
+	return registerThread(name);
+}
+void Profiler::removeTrack(ProfileThread* track)
+{
+	if (track != nullptr)
+		retireThread(track);
+}
+void Profiler::record(ProfileThread* track, const char* name, std::int64_t start, std::int64_t end)
+{
+	std::uint64_t index{ track->written.load(std::memory_order_relaxed) };
+	track->events[index % PROFILER_EVENTS_PER_THREAD] = ProfileEvent{ name, start, end };
+	track->written.store(index + 1, std::memory_order_release);
+}
+void Profiler::setThreadName(const char* name)
+{
+	ProfileThread& thread{ currentThread() };
+	std::lock_guard<std::mutex> lock{ registryMutex };
+	thread.name = name;
+}
+void Profiler::clear()
+{
+	std::lock_guard<std::mutex> lock{ registryMutex };
+	registry.erase(std::remove_if(registry.begin(), registry.end(),
+		[](const std::shared_ptr<ProfileThread>& thread) { return thread->exited; }), registry.end());
+	for (const std::shared_ptr<ProfileThread>& thread : registry)
+		thread->written.store(0, std::memory_order_release);
+}
+std::size_t Profiler::bufferBytes()
+{
+	std::lock_guard<std::mutex> lock{ registryMutex };
+	std::size_t events{ 0 };
+	for (const std::shared_ptr<ProfileThread>& thread : registry)
+		events += thread->events.capacity();
+	for (const std::vector<ProfileEvent>& buffer : spareBuffers)
+		events += buffer.capacity();
+	return events * sizeof(ProfileEvent);
+}
+// CHROME TRACE EXPORT
+// -------------------
+// Complete ("X") events with microsecond timestamps, plus thread_name metadata.
+// Threads keep recording while this runs; an event overwritten mid-copy can
+// come out garbled, so export between frames or with recording disabled.
+static void writeJsonString(std::ofstream& file, const char* text)
+{
+	file << '"';
+	for (const char* c{ text }; *c != '\0'; ++c)
+	{
+		if (*c == '"' || *c == '\\')
+			file << '\\';
+		file << *c;
+	}
+	file << '"';
+}
+bool Profiler::writeChromeTrace(const std::string& path)
+{
+	std::ofstream file{ path };
+	if (!file)
+	{
+		std::cout << "Failed to open profile output " << path << std::endl;
+		return false;
+	}
+	std::vector<std::shared_ptr<ProfileThread>> threads{};
+	{
+		std::lock_guard<std::mutex> lock{ registryMutex };
+		threads = registry;
+	}
+	double microsecondsPerTick{ 0.001 / ticksPerNanosecond() };
+	file << std::fixed << std::setprecision(3);
+	file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	bool first{ true };
+	std::size_t exported{ 0 };
+	for (const std::shared_ptr<ProfileThread>& thread : threads)
+	{
+		file << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread->id << ",\"args\":{\"name\":";
+		{
+			std::lock_guard<std::mutex> lock{ registryMutex };
+			writeJsonString(file, thread->name.c_str());
+		}
+		file << "}}";
+		first = false;
+
+		std::uint64_t written{ thread->written.load(std::memory_order_acquire) };
+		std::uint64_t oldest{ written > (std::uint64_t)PROFILER_EVENTS_PER_THREAD ? written - PROFILER_EVENTS_PER_THREAD : 0 };
+		for (std::uint64_t i{ oldest }; i < written; ++i)
+		{
+			const ProfileEvent& event{ thread->events[i % PROFILER_EVENTS_PER_THREAD] };
+			file << ",\n{\"name\":";
+			writeJsonString(file, event.name);
+			file << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread->id << ",\"ts\":" << (event.start - epochTicks) * microsecondsPerTick
+				<< ",\"dur\":" << (event.end - event.start) * microsecondsPerTick << "}";
+			++exported;
+		}
+	}
+	file << "\n]}\n";
+	std::cout << "Wrote " << exported << " profile zones to " << path << std::endl;
+	return (bool)file;
+}
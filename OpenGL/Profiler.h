@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+struct ProfileThread;
+
+// CPU PROFILER
+// ------------
+// Scoped timing zones recorded into a fixed size ring buffer per thread (the
+// newest PROFILER_EVENTS_PER_THREAD zones survive), written out on demand as
+// Chrome trace JSON that chrome://tracing and ui.perfetto.dev both open.
+// Recording a zone is two timestamp reads (rdtsc on x86-64, steady_clock
+// elsewhere) and a store into thread local memory, no locks. Recording is off
+// until Profiler::setEnabled(true); define ENGINE_NO_PROFILER to compile the
+// zones out entirely. When a thread exits its zones are kept for export until
+// clear() and its ring buffer is reused by the next thread that records.
+//
+//   {
+//       PROFILE_SCOPE("Render");
+//       ...
+//   }
+//
+// Zone names must outlive the profiler, use string literals.
+class Profiler
+{
+public:
+	static void setEnabled(bool enabled);
+	static bool enabled();
+	static void setThreadName(const char* name); // shown as the thread's track name
+	static bool writeChromeTrace(const std::string& path);
+	static void clear(); // drops every recorded zone, including those of exited threads
+	static std::size_t bufferBytes(); // event memory held, spare ring buffers included
+
+	static std::int64_t timestamp(); // raw ticks, converted to time on export
+	static double ticksPerNanosecond();
+	static void record(const char* name, std::int64_t start, std::int64_t end);
+
+	// Extra timelines not tied to a CPU thread, e.g. the GPU. Only one thread at
+	// a time may record into a track.
+	static ProfileThread* addTrack(const char* name);
+	static void removeTrack(ProfileThread* track); // like a thread exiting, its zones stay until clear()
+	static void record(ProfileThread* track, const char* name, std::int64_t start, std::int64_t end);
+};
+
+constexpr int PROFILER_EVENTS_PER_THREAD{ 1 << 16 };
+
+class ProfileScope
+{
+public:
+	explicit ProfileScope(const char* name)
+		: m_name{ Profiler::enabled() ? name : nullptr }, m_start{ m_name != nullptr ? Profiler::timestamp() : 0 }
+	{
+	}
+	~ProfileScope()
+	{
+		if (m_name != nullptr)
+			Profiler::record(m_name, m_start, Profiler::timestamp());
+	}
+	ProfileScope(const ProfileScope&) = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+	const char* m_name;
+	std::int64_t m_start;
+};
+
+#define PROFILE_CONCATENATE_INNER(a, b) a##b
+#define PROFILE_CONCATENATE(a, b) PROFILE_CONCATENATE_INNER(a, b)
+#ifdef ENGINE_NO_PROFILER
+#define PROFILE_SCOPE(name)
+#else
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCATENATE(profileScope, __LINE__){ name }
+#endif
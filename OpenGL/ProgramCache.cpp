@@ -0,0 +1,255 @@
+#include "ProgramCache.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+// CACHE FILE FORMAT
+// -----------------
+// One file per program: header followed by the driver's binary blob.
+struct ProgramBinaryHeader
+{
+	std::uint32_t magic;
+	std::uint32_t version;
+	std::uint64_t key;
+	std::uint64_t driverHash;
+	std::uint64_t checksum;
+	std::uint32_t format;
+	std::uint32_t length;
+};
+
+constexpr std::uint32_t PROGRAM_BINARY_MAGIC{ 0x42504C47 }; // "GLPB"
+constexpr std::uint32_t PROGRAM_BINARY_VERSION{ 1 };
+
+// FNV-1a, chained through the seed so several strings hash as one
+static std::uint64_t hashBytes(const void* data, std::size_t size, std::uint64_t seed = 14695981039346656037ull)
+{
+	const unsigned char* bytes{ static_cast<const unsigned char*>(data) };
+	std::uint64_t hash{ seed };
+	for (std::size_t i{ 0 }; i < size; ++i)
+	{
+		hash ^= bytes[i];
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+static std::uint64_t hashString(const char* text, std::uint64_t seed)
+{
+	// Include the terminator so {"ab","c"} and {"a","bc"} hash differently
+	return text != NULL ? hashBytes(text, std::strlen(text) + 1, seed) : hashBytes("", 1, seed);
+}
+
+ProgramCache::ProgramCache(std::string directory)
+	: m_directory{ std::move(directory) }
+{
+}
+// DRIVER IDENTITY
+// ---------------
+void ProgramCache::queryDriver()
+{
+	if (m_queried)
+		return;
+	m_queried = true;
+	int major{ 0 }, minor{ 0 };
+	glGetIntegerv(GL_MAJOR_VERSION, &major);
+	glGetIntegerv(GL_MINOR_VERSION, &minor);
+	// glad only loads the entry points with the 4.1 core functions, so an
+	// ARB_get_program_binary context below 4.1 still has them NULL
+	bool hasBinaries{ (major > 4 || (major == 4 && minor >= 1) || gladHasExtension("GL_ARB_get_program_binary"))
+		&& glProgramBinary != NULL && glGetProgramBinary != NULL && glProgramParameteri != NULL };
+	int formats{ 0 };
+	if (hasBinaries)
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	m_supported = formats > 0 && !m_directory.empty();
+
+	m_driverHash = hashString((const char*)glGetString(GL_VENDOR), 14695981039346656037ull);
+	m_driverHash = hashString((const char*)glGetString(GL_RENDERER), m_driverHash);
+	m_driverHash = hashString((const char*)glGetString(GL_VERSION), m_driverHash);
+	if (m_supported)
+	{
+		std::error_code error{};
+		std::filesystem::create_directories(m_directory, error);
+		if (error)
+		{
+			std::cout << "Program cache disabled, cannot create " << m_directory << ": " << error.message() << std::endl;
+			m_supported = false;
+		}
+	}
+}
+bool ProgramCache::enabled()
+{
+	queryDriver();
+	return m_supported;
+}
+std::uint64_t ProgramCache::key(const char* const* sources, int count)
+{
+	queryDriver();
+	std::uint64_t hash{ m_driverHash };
+	for (int i{ 0 }; i < count; ++i)
+		hash = hashString(sources[i], hash);
+	return hash;
+}
+std::string ProgramCache::path(std::uint64_t key) const
+{
+	char name[32];
+	std::snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+	return (std::filesystem::path{ m_directory } / name).string();
+}
+// LOAD
+// ----
+unsigned int ProgramCache::load(std::uint64_t key)
+{
+	++m_stats.misses; // taken back on a hit
+	if (!enabled())
+		return 0;
+	std::ifstream file{ path(key), std::ios::binary | std::ios::ate };
+	if (!file)
+		return 0;
+	std::streamoff fileSize{ file.tellg() };
+	file.seekg(0);
+	ProgramBinaryHeader header{};
+	std::vector<char> binary{};
+	// The length comes from disk, only trust it as far as the file actually reaches
+	bool complete{ file.read(reinterpret_cast<char*>(&header), sizeof(header))
+		&& header.length <= fileSize - (std::streamoff)sizeof(header) };
+	if (complete)
+	{
+		binary.resize(header.length);
+		file.read(binary.data(), header.length);
+	}
+	bool valid{ complete && file && header.magic == PROGRAM_BINARY_MAGIC && header.version == PROGRAM_BINARY_VERSION
+		&& header.key == key && header.driverHash == m_driverHash
+		&& header.checksum == hashBytes(binary.data(), binary.size()) };
+	if (!valid)
+	{
+		++m_stats.rejected;
+		return 0;
+	}
+	unsigned int program{ glCreateProgram() };
+	glProgramBinary(program, header.format, binary.data(), (GLsizei)binary.size());
+	int success;
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (!success)
+	{
+		// The driver changed its mind about the binary, rebuild from source and overwrite it
+		glDeleteProgram(program);
+		++m_stats.rejected;
+		return 0;
+	}
+	--m_stats.misses;
+	++m_stats.hits;
+	return program;
+}
+// STORE
+// -----
+void ProgramCache::store(std::uint64_t key, unsigned int program)
+{
+	if (!enabled() || program == 0)
+		return;
+	int length{ 0 };
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+		return;
+	std::vector<char> binary(length);
+	ProgramBinaryHeader header{};
+	GLenum format{ 0 };
+	glGetProgramBinary(program, length, &length, &format, binary.data());
+	binary.resize(length);
+	header.magic = PROGRAM_BINARY_MAGIC;
+	header.version = PROGRAM_BINARY_VERSION;
+	header.key = key;
+	header.driverHash = m_driverHash;
+	header.checksum = hashBytes(binary.data(), binary.size());
+	header.format = format;
+	header.length = (std::uint32_t)binary.size();
+
+	// Write to a unique temporary and rename, so concurrent jobs never read a half written file
+	std::string target{ path(key) };
+	std::string temporary{ target + "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".tmp" };
+	{
+		std::ofstream file{ temporary, std::ios::binary | std::ios::trunc };
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(binary.data(), binary.size());
+		if (!file)
+			return;
+	}
+	std::error_code error{};
+	std::filesystem::rename(temporary, target, error);
+	if (error)
+	{
+		std::filesystem::remove(temporary, error);
+		return;
+	}
+	++m_stats.stores;
+}
+// BUILD
+// -----
+unsigned int ProgramCache::build(const char* vertexSource, const char* fragmentSource)
+{
+	const char* sources[]{ vertexSource, fragmentSource };
+	std::uint64_t programKey{ key(sources, 2) };
+	unsigned int program{ load(programKey) };
+	if (program != 0)
+		return program;
+
+	unsigned int vertexShader{ compileShader(GL_VERTEX_SHADER, vertexSource) };
+	unsigned int fragmentShader{ compileShader(GL_FRAGMENT_SHADER, fragmentSource) };
+	if (vertexShader != 0 && fragmentShader != 0)
+		program = linkProgram(vertexShader, fragmentShader, enabled());
+	glDeleteShader(vertexShader);
+	glDeleteShader(fragmentShader);
+	store(programKey, program);
+	return program;
+}
+void ProgramCache::printStats() const
+{
+	std::cout << "Program cache: " << m_stats.hits << " hits, " << m_stats.misses << " misses, "
+		<< m_stats.stores << " stored, " << m_stats.rejected << " rejected" << std::endl;
+}
+
+// SHADER HELPERS
+// --------------
+unsigned int compileShader(GLenum type, const char* source)
+{
+	unsigned int shader{ glCreateShader(type) };
+	glShaderSource(shader, 1, &source, NULL);
+	glCompileShader(shader);
+
+	int success;
+	char infoLog[512];
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+	if (!success)
+	{
+		glGetShaderInfoLog(shader, 512, NULL, infoLog);
+		std::cout << (type == GL_VERTEX_SHADER ? "Vertex" : "Fragment") << " shader compilation failed" << infoLog << std::endl;
+		glDeleteShader(shader);
+		return 0;
+	}
+	return shader;
+}
+unsigned int linkProgram(unsigned int vertexShader, unsigned int fragmentShader, bool retrievable)
+{
+	unsigned int program{ glCreateProgram() };
+	if (retrievable)
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	glAttachShader(program, vertexShader);
+	glAttachShader(program, fragmentShader);
+	glLinkProgram(program);
+
+	int success;
+	char infoLog[512];
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (!success)
+	{
+		glGetProgramInfoLog(program, 512, NULL, infoLog);
+		std::cout << "Failed to link shader program" << infoLog << std::endl;
+		glDeleteProgram(program);
+		return 0;
+	}
+	return program;
+}
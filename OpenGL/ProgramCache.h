@@ -0,0 +1,57 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+#include <string>
+
+// PROGRAM CACHE STATISTICS
+// ------------------------
+struct ProgramCacheStats
+{
+	int hits{ 0 };     // programs restored from a cached binary
+	int misses{ 0 };   // lookups that found no usable binary and had to compile from source
+	int stores{ 0 };   // binaries written back to the cache
+	int rejected{ 0 }; // cached binaries the driver refused (driver update, corrupt file)
+};
+
+// PROGRAM CACHE
+// -------------
+// On-disk cache of linked program binaries (glGetProgramBinary/glProgramBinary).
+// Entries are keyed by a hash of every shader source plus the driver's vendor,
+// renderer and version strings, so a driver change simply misses. When the
+// driver still refuses a binary the program is rebuilt from source and the
+// entry replaced. Needs a current context; without the GL 4.1 program binary
+// entry points, or with an empty directory, every lookup is a miss.
+class ProgramCache
+{
+public:
+	explicit ProgramCache(std::string directory = "shader_cache");
+
+	// Cached program for the sources, compiled and stored on a miss. Returns 0 on failure.
+	unsigned int build(const char* vertexSource, const char* fragmentSource);
+
+	// Building blocks for callers that compile programs themselves. load() returns 0 on a
+	// miss, programs passed to store() should be linked with the retrievable hint set.
+	std::uint64_t key(const char* const* sources, int count);
+	unsigned int load(std::uint64_t key);
+	void store(std::uint64_t key, unsigned int program);
+
+	bool enabled();
+	const ProgramCacheStats& stats() const { return m_stats; }
+	void printStats() const;
+
+private:
+	void queryDriver();
+	std::string path(std::uint64_t key) const;
+
+	std::string m_directory;
+	ProgramCacheStats m_stats{};
+	bool m_queried{ false };
+	bool m_supported{ false };
+	std::uint64_t m_driverHash{ 0 };
+};
+
+// SHADER HELPERS
+// --------------
+// Compile/link with the info log printed on failure. Both return 0 on failure.
+unsigned int compileShader(GLenum type, const char* source);
+unsigned int linkProgram(unsigned int vertexShader, unsigned int fragmentShader, bool retrievable);
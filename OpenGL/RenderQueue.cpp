@@ -0,0 +1,138 @@
+#include "RenderQueue.h"
+#include "FrameStats.h"
+#include "Profiler.h"
+#include "RenderState.h"
+#include <cstring>
+
+std::uint64_t makeSortKey(unsigned int pass, unsigned int program, unsigned int material, unsigned int vertexArray, float depth)
+{
+	if (depth < 0.0f)
+		depth = 0.0f;
+	if (depth > 1.0f)
+		depth = 1.0f;
+	std::uint64_t quantizedDepth{ (std::uint64_t)(depth * 0xFFFFF) };
+	return ((std::uint64_t)(pass & 0xF) << 60)
+		| ((std::uint64_t)(program & 0xFFF) << 48)
+		| ((std::uint64_t)(material & 0xFFFF) << 32)
+		| ((std::uint64_t)(vertexArray & 0xFFF) << 20)
+		| quantizedDepth;
+}
+// RADIX SORT
+// ----------
+// Least significant digit first, one byte per pass, ping-ponging between the
+// order and scratch arrays. Passes where every key has the same byte are
+// skipped, which is most of them for typical scenes (few passes and programs).
+void RenderQueue::sort()
+{
+	PROFILE_SCOPE("RenderQueue::sort");
+	std::size_t count{ m_items.size() };
+	m_sorted = true;
+	m_order.resize(count);
+	m_scratch.resize(count);
+	for (std::size_t i{ 0 }; i < count; ++i)
+		m_order[i] = SortEntry{ m_items[i].key, (std::uint32_t)i };
+	if (count < 2)
+		return;
+
+	std::size_t histograms[8][256];
+	std::memset(histograms, 0, sizeof(histograms));
+	for (const SortEntry& entry : m_order)
+	{
+		for (int digit{ 0 }; digit < 8; ++digit)
+			++histograms[digit][(entry.key >> (digit * 8)) & 0xFF];
+	}
+
+	SortEntry* source{ m_order.data() };
+	SortEntry* destination{ m_scratch.data() };
+	for (int digit{ 0 }; digit < 8; ++digit)
+	{
+		std::size_t* histogram{ histograms[digit] };
+		if (histogram[(source[0].key >> (digit * 8)) & 0xFF] == count)
+			continue;
+		std::size_t offset{ 0 };
+		for (int bucket{ 0 }; bucket < 256; ++bucket)
+		{
+			std::size_t size{ histogram[bucket] };
+			histogram[bucket] = offset;
+			offset += size;
+		}
+		for (std::size_t i{ 0 }; i < count; ++i)
+			destination[histogram[(source[i].key >> (digit * 8)) & 0xFF]++] = source[i];
+		SortEntry* swap{ source };
+		source = destination;
+		destination = swap;
+	}
+	if (source != m_order.data())
+		m_order.swap(m_scratch);
+}
+// SUBMISSION
+// ----------
+void drawItem(const DrawItem& item, int count)
+{
+	countDraw(item.mode, count, item.instanceCount);
+	if (item.indexType == 0)
+	{
+		if (item.instanceCount == 1)
+			glDrawArrays(item.mode, item.first, count);
+		else
+			glDrawArraysInstanced(item.mode, item.first, count, item.instanceCount);
+		return;
+	}
+	std::size_t indexSize{ item.indexType == GL_UNSIGNED_SHORT ? 2u : item.indexType == GL_UNSIGNED_BYTE ? 1u : 4u };
+	void* offset{ (void*)(item.first * indexSize) };
+	if (item.instanceCount == 1)
+		glDrawElementsBaseVertex(item.mode, count, item.indexType, offset, item.baseVertex);
+	else
+		glDrawElementsInstancedBaseVertex(item.mode, count, item.indexType, offset, item.instanceCount, item.baseVertex);
+}
+// Strips, fans and loops connect consecutive vertices, so concatenating two
+// of them would draw primitives bridging the ranges; only lists can merge
+bool canMerge(const DrawItem& item, int count, const DrawItem& next)
+{
+	bool list{ item.mode == GL_TRIANGLES || item.mode == GL_LINES || item.mode == GL_POINTS };
+	return list && item.instanceCount == 1 && next.instanceCount == 1
+		&& next.program == item.program && next.vertexArray == item.vertexArray
+		&& next.texture == item.texture && next.mode == item.mode
+		&& next.indexType == item.indexType && next.baseVertex == item.baseVertex
+		&& next.first == item.first + count;
+}
+void RenderQueue::flush(RenderStateCache& state)
+{
+	PROFILE_SCOPE("RenderQueue::flush");
+	if (!m_sorted)
+		sort();
+	m_stats = RenderQueueStats{};
+	m_stats.items = (int)m_items.size();
+
+	std::size_t i{ 0 };
+	while (i < m_order.size())
+	{
+		const DrawItem& item{ m_items[m_order[i].index] };
+		int count{ item.count };
+		std::size_t next{ i + 1 };
+		// Fold following items that continue this one's range with identical state
+		while (next < m_order.size())
+		{
+			const DrawItem& candidate{ m_items[m_order[next].index] };
+			if (!canMerge(item, count, candidate))
+				break;
+			count += candidate.count;
+			++m_stats.merged;
+			++next;
+		}
+		state.useProgram(item.program);
+		state.bindVertexArray(item.vertexArray);
+		// Texture 0 as well, an untextured item must not sample the previous one's
+		state.bindTexture(0, GL_TEXTURE_2D, item.texture);
+		drawItem(item, count);
+		++m_stats.draws;
+		i = next;
+	}
+	clear();
+}
+void RenderQueue::clear()
+{
+	m_items.clear();
+	m_order.clear();
+	m_sorted = false;
+}
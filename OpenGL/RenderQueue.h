@@ -0,0 +1,91 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+#include <vector>
+
+class RenderStateCache;
+
+// SORT KEY
+// --------
+// 64-bit key, most significant field first, so sorting the keys groups draws
+// by pass, then program, then material, then vertex array, then depth:
+//
+//   63..60  pass          (4 bits)
+//   59..48  program       (12 bits)
+//   47..32  material      (16 bits)
+//   31..20  vertex array  (12 bits)
+//   19..0   depth         (20 bits, 0 = near)
+//
+// Ids wider than their field are masked; that can only merge groups in the
+// sort order, the draw itself always uses the full ids stored in the item.
+std::uint64_t makeSortKey(unsigned int pass, unsigned int program, unsigned int material, unsigned int vertexArray, float depth);
+
+// Back-to-front passes (transparency) flip the depth so the far draws sort first
+inline float backToFront(float depth) { return 1.0f - depth; }
+
+// DRAW ITEM
+// ---------
+struct DrawItem
+{
+	std::uint64_t key{ 0 };
+	unsigned int program{ 0 };
+	unsigned int vertexArray{ 0 };
+	unsigned int texture{ 0 };      // bound to unit 0 as GL_TEXTURE_2D, 0 unbinds
+	GLenum mode{ GL_TRIANGLES };
+	GLenum indexType{ 0 };          // 0 draws arrays, otherwise GL_UNSIGNED_SHORT/GL_UNSIGNED_INT
+	int first{ 0 };                 // first vertex, or first index for indexed draws
+	int count{ 0 };
+	int baseVertex{ 0 };            // indexed draws only
+	int instanceCount{ 1 };
+};
+
+// Issues the GL draw call for item with count vertices/indices (the caller
+// binds its program, vertex array and texture)
+void drawItem(const DrawItem& item, int count);
+// Whether next can be folded into a draw of item's first count vertices/indices:
+// same state, not instanced, continuing the range, and a list primitive
+// (GL_TRIANGLES, GL_LINES, GL_POINTS)
+bool canMerge(const DrawItem& item, int count, const DrawItem& next);
+
+struct RenderQueueStats
+{
+	int items{ 0 };  // items submitted
+	int draws{ 0 };  // draw calls issued after batching
+	int merged{ 0 }; // items folded into the previous draw
+};
+
+// RENDER QUEUE
+// ------------
+// Collects a frame's draw items in any order, radix sorts them by key and
+// submits them through the RenderStateCache so state only changes between
+// groups. Consecutive non-instanced list primitive items that share all
+// state and cover adjacent vertex/index ranges are merged into one draw call.
+class RenderQueue
+{
+public:
+	void submit(const DrawItem& item)
+	{
+		m_items.push_back(item);
+		m_sorted = false;
+	}
+	void sort();
+	void flush(RenderStateCache& state); // sort (unless already sorted), draw and clear
+	void clear();
+
+	const DrawItem& sorted(int index) const { return m_items[m_order[index].index]; }
+	int size() const { return (int)m_items.size(); }
+	const RenderQueueStats& stats() const { return m_stats; }
+
+private:
+	struct SortEntry
+	{
+		std::uint64_t key;
+		std::uint32_t index;
+	};
+
+	std::vector<DrawItem> m_items{};
+	std::vector<SortEntry> m_order{};
+	std::vector<SortEntry> m_scratch{};
+	RenderQueueStats m_stats{};
+	bool m_sorted{ false };
+};
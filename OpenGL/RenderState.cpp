@@ -0,0 +1,173 @@
+#include "RenderState.h"
+
+RenderStateCache::RenderStateCache()
+{
+	invalidate();
+}
+void RenderStateCache::invalidate()
+{
+	m_program = UNKNOWN;
+	m_vertexArray = UNKNOWN;
+	for (unsigned int& buffer : m_buffers)
+		buffer = UNKNOWN;
+	m_activeTexture = UNKNOWN;
+	for (int i{ 0 }; i < MAX_TEXTURE_UNITS; ++i)
+	{
+		m_textureTargets[i] = 0;
+		m_textures[i] = UNKNOWN;
+	}
+	m_blend = Toggle::Unknown;
+	m_blendSource = m_blendDestination = UNKNOWN;
+	m_depthTest = Toggle::Unknown;
+	m_depthFunc = UNKNOWN;
+	m_depthMask = Toggle::Unknown;
+	m_cullFace = Toggle::Unknown;
+}
+void RenderStateCache::beginFrame()
+{
+	m_lastFrame = m_frame;
+	m_frame = RenderStateCounters{};
+}
+// COUNTING
+// --------
+bool RenderStateCache::issue(bool changed)
+{
+	if (changed)
+	{
+		++m_frame.issued;
+		++m_total.issued;
+	}
+	else
+	{
+		++m_frame.elided;
+		++m_total.elided;
+	}
+	return changed;
+}
+// BINDINGS
+// --------
+void RenderStateCache::useProgram(unsigned int program)
+{
+	if (!issue(m_program != program))
+		return;
+	m_program = program;
+	++m_frame.programSwitches;
+	++m_total.programSwitches;
+	glUseProgram(program);
+}
+void RenderStateCache::bindVertexArray(unsigned int vertexArray)
+{
+	if (!issue(m_vertexArray != vertexArray))
+		return;
+	m_vertexArray = vertexArray;
+	++m_frame.vertexArraySwitches;
+	++m_total.vertexArraySwitches;
+	glBindVertexArray(vertexArray);
+	// The element array binding belongs to the vertex array object, so it just changed with it
+	m_buffers[bufferSlot(GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN;
+}
+int RenderStateCache::bufferSlot(GLenum target)
+{
+	switch (target)
+	{
+	case GL_ARRAY_BUFFER: return 0;
+	case GL_ELEMENT_ARRAY_BUFFER: return 1;
+	case GL_UNIFORM_BUFFER: return 2;
+	case GL_SHADER_STORAGE_BUFFER: return 3;
+	case GL_DRAW_INDIRECT_BUFFER: return 4;
+	case GL_PARAMETER_BUFFER: return 5;
+	case GL_COPY_READ_BUFFER: return 6;
+	case GL_COPY_WRITE_BUFFER: return 7;
+	default: return -1;
+	}
+}
+void RenderStateCache::bindBuffer(GLenum target, unsigned int buffer)
+{
+	int slot{ bufferSlot(target) };
+	if (slot < 0)
+	{
+		// Untracked target, always pass through
+		issue(true);
+		glBindBuffer(target, buffer);
+		return;
+	}
+	if (!issue(m_buffers[slot] != buffer))
+		return;
+	m_buffers[slot] = buffer;
+	++m_frame.bufferBinds;
+	++m_total.bufferBinds;
+	glBindBuffer(target, buffer);
+}
+void RenderStateCache::bindTexture(unsigned int unit, GLenum target, unsigned int texture)
+{
+	if (unit >= (unsigned int)MAX_TEXTURE_UNITS)
+	{
+		issue(true);
+		++m_frame.textureBinds;
+		++m_total.textureBinds;
+		glActiveTexture(GL_TEXTURE0 + unit);
+		glBindTexture(target, texture);
+		m_activeTexture = unit;
+		return;
+	}
+	if (!issue(m_textures[unit] != texture || m_textureTargets[unit] != target))
+		return;
+	if (m_activeTexture != unit)
+	{
+		glActiveTexture(GL_TEXTURE0 + unit);
+		m_activeTexture = unit;
+	}
+	m_textures[unit] = texture;
+	m_textureTargets[unit] = target;
+	++m_frame.textureBinds;
+	++m_total.textureBinds;
+	glBindTexture(target, texture);
+}
+// FIXED FUNCTION STATE
+// --------------------
+void RenderStateCache::setCapability(GLenum capability, Toggle& current, bool enabled)
+{
+	Toggle wanted{ enabled ? Toggle::On : Toggle::Off };
+	if (!issue(current != wanted))
+		return;
+	current = wanted;
+	if (enabled)
+		glEnable(capability);
+	else
+		glDisable(capability);
+}
+void RenderStateCache::setBlend(bool enabled)
+{
+	setCapability(GL_BLEND, m_blend, enabled);
+}
+void RenderStateCache::blendFunc(GLenum source, GLenum destination)
+{
+	if (!issue(m_blendSource != source || m_blendDestination != destination))
+		return;
+	m_blendSource = source;
+	m_blendDestination = destination;
+	glBlendFunc(source, destination);
+}
+void RenderStateCache::setDepthTest(bool enabled)
+{
+	setCapability(GL_DEPTH_TEST, m_depthTest, enabled);
+}
+void RenderStateCache::depthFunc(GLenum function)
+{
+	if (!issue(m_depthFunc != function))
+		return;
+	m_depthFunc = function;
+	glDepthFunc(function);
+}
+void RenderStateCache::depthMask(bool enabled)
+{
+	Toggle wanted{ enabled ? Toggle::On : Toggle::Off };
+	if (!issue(m_depthMask != wanted))
+		return;
+	m_depthMask = wanted;
+	glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+}
+void RenderStateCache::setCullFace(bool enabled)
+{
+	setCapability(GL_CULL_FACE, m_cullFace, enabled);
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <glad/glad.h>
+
+// RENDER STATE COUNTERS
+// ---------------------
+struct RenderStateCounters
+{
+	long long issued{ 0 }; // state calls that reached GL
+	long long elided{ 0 }; // state calls skipped because GL already had that state
+	long long programSwitches{ 0 };
+	long long vertexArraySwitches{ 0 };
+	long long bufferBinds{ 0 };
+	long long textureBinds{ 0 };
+};
+
+// RENDER STATE CACHE
+// ------------------
+// Shadow copy of the GL state the renderer touches. Every setter compares with
+// the shadow value and only calls GL when something actually changes, so code
+// can set the state it needs per draw without caring what was bound before.
+// Everything starts out unknown, the first call for each piece of state always
+// reaches GL. After GL state is changed behind the cache's back (raw gl* calls,
+// deleting a bound object) call invalidate().
+class RenderStateCache
+{
+public:
+	RenderStateCache();
+
+	void invalidate();
+	void beginFrame(); // moves the running counters to lastFrame()
+
+	void useProgram(unsigned int program);
+	void bindVertexArray(unsigned int vertexArray);
+	void bindBuffer(GLenum target, unsigned int buffer);
+	void bindTexture(unsigned int unit, GLenum target, unsigned int texture);
+
+	void setBlend(bool enabled);
+	void blendFunc(GLenum source, GLenum destination);
+	void setDepthTest(bool enabled);
+	void depthFunc(GLenum function);
+	void depthMask(bool enabled);
+	void setCullFace(bool enabled);
+
+	unsigned int program() const { return m_program; }
+	unsigned int vertexArray() const { return m_vertexArray; }
+
+	const RenderStateCounters& frame() const { return m_frame; }
+	const RenderStateCounters& lastFrame() const { return m_lastFrame; }
+	const RenderStateCounters& total() const { return m_total; }
+
+	static constexpr int MAX_TEXTURE_UNITS{ 32 };
+
+private:
+	enum class Toggle
+	{
+		Unknown,
+		Off,
+		On
+	};
+
+	bool issue(bool changed);
+	void setCapability(GLenum capability, Toggle& current, bool enabled);
+	static int bufferSlot(GLenum target);
+
+	static constexpr unsigned int UNKNOWN{ 0xFFFFFFFFu };
+	static constexpr int BUFFER_SLOTS{ 8 };
+
+	unsigned int m_program;
+	unsigned int m_vertexArray;
+	unsigned int m_buffers[BUFFER_SLOTS];
+	unsigned int m_activeTexture;
+	GLenum m_textureTargets[MAX_TEXTURE_UNITS];
+	unsigned int m_textures[MAX_TEXTURE_UNITS];
+	Toggle m_blend;
+	GLenum m_blendSource;
+	GLenum m_blendDestination;
+	Toggle m_depthTest;
+	GLenum m_depthFunc;
+	Toggle m_depthMask;
+	Toggle m_cullFace;
+
+	RenderStateCounters m_frame{};
+	RenderStateCounters m_lastFrame{};
+	RenderStateCounters m_total{};
+};
@@ -0,0 +1,437 @@
+#include "Context.h"
+#include "GLTrace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// GL TRACE REPLAY
+// ---------------
+// Re-executes a trace written by GLTrace on a fresh headless context, once per
+// loop, and reports how long the GL calls took per frame. Every loop creates
+// its own context so objects come back with the names the trace recorded.
+//
+//   Replay capture.gltrace [--loops <count>]
+struct ReplayOptions
+{
+	std::string path{};
+	int loops{ 3 };
+};
+
+using Clock = std::chrono::steady_clock;
+
+static double millisecondsSince(Clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// TRACE READER
+// ------------
+class TraceReader
+{
+public:
+	TraceReader(const std::vector<char>& data)
+		: m_data{ data }
+	{
+	}
+
+	template<typename T>
+	T read()
+	{
+		T value{};
+		if (m_position + sizeof(T) > m_data.size())
+		{
+			m_failed = true;
+			return value;
+		}
+		std::memcpy(&value, m_data.data() + m_position, sizeof(T));
+		m_position += sizeof(T);
+		return value;
+	}
+	// Arguments as the tracer wrote them: pointers widened to 8 bytes
+	template<typename T>
+	T argument()
+	{
+		if constexpr (std::is_pointer<T>::value)
+			return (T)(std::uintptr_t)read<std::uint64_t>();
+		else
+			return read<T>();
+	}
+	const char* bytes(std::size_t size)
+	{
+		if (m_position + size > m_data.size())
+		{
+			m_failed = true;
+			return nullptr;
+		}
+		const char* data{ m_data.data() + m_position };
+		m_position += size;
+		return data;
+	}
+
+	bool done() const { return m_position >= m_data.size() || m_failed; }
+	bool failed() const { return m_failed; }
+	void rewind(std::size_t position) { m_position = position; }
+	std::size_t position() const { return m_position; }
+
+private:
+	const std::vector<char>& m_data;
+	std::size_t m_position{ 0 };
+	bool m_failed{ false };
+};
+
+// REPLAY STATE
+// ------------
+struct Blob
+{
+	GLTraceBlob kind{ GLTraceBlob::Bytes };
+	const char* data{ nullptr };
+	std::uint32_t size{ 0 };
+};
+
+struct ReplayState
+{
+	std::vector<char> scratch{};                              // glGet* outputs and client memory the trace has no copy of
+	std::unordered_map<std::uint64_t, std::uint64_t> pointers{}; // recorded GLsync and mapping addresses to replayed ones
+	std::vector<std::string> strings{};
+	std::vector<const GLchar*> stringPointers{};
+	long long calls{ 0 };
+	long long mismatches{ 0 };     // generated names and locations that differ from the capture
+	long long unknownPointers{ 0 }; // client pointers replayed as zeroed scratch memory
+};
+
+constexpr std::size_t REPLAY_SCRATCH_SIZE{ 64 << 20 };
+
+struct ReplayFlags
+{
+	bool query{ false };       // glGet*, glReadPixels: pointers are outputs
+	bool checkResult{ false }; // returns a name or location the rest of the trace relies on
+	bool noLengths{ false };   // glShaderSource: lengths are baked into the replayed strings
+};
+
+template<typename T>
+static void resolvePointer(T& value, const Blob& blob, ReplayState& state, const ReplayFlags& flags)
+{
+	if constexpr (std::is_pointer<T>::value)
+	{
+		std::uint64_t recorded{ (std::uint64_t)(std::uintptr_t)value };
+		if constexpr (std::is_function<typename std::remove_pointer<T>::type>::value)
+			value = nullptr; // callbacks point into the capturing process
+		else if constexpr (std::is_same<T, GLsync>::value)
+		{
+			auto found{ state.pointers.find(recorded) };
+			value = found != state.pointers.end() ? (T)(std::uintptr_t)found->second : nullptr;
+		}
+		else if (blob.data != nullptr && blob.kind == GLTraceBlob::Bytes)
+			value = (T)(std::uintptr_t)blob.data;
+		else if (blob.data != nullptr && blob.kind == GLTraceBlob::StringArray)
+		{
+			std::uint32_t count;
+			std::memcpy(&count, blob.data, sizeof(count));
+			const char* cursor{ blob.data + sizeof(count) };
+			state.strings.clear();
+			for (std::uint32_t i{ 0 }; i < count; ++i)
+			{
+				std::uint32_t length;
+				std::memcpy(&length, cursor, sizeof(length));
+				cursor += sizeof(length);
+				state.strings.emplace_back(cursor, length);
+				cursor += length;
+			}
+			state.stringPointers.clear();
+			for (const std::string& string : state.strings)
+				state.stringPointers.push_back(string.c_str());
+			value = (T)(std::uintptr_t)state.stringPointers.data();
+		}
+		else if (recorded == 0)
+			return;
+		else if (blob.data != nullptr || flags.query || recorded >= 0x100000000ull)
+		{
+			// Outputs, or client memory: real addresses, offsets into buffers are small
+			if (blob.data == nullptr && !flags.query)
+				++state.unknownPointers;
+			std::fill(state.scratch.begin(), state.scratch.begin() + 4096, 0);
+			value = (T)(std::uintptr_t)state.scratch.data();
+		}
+	}
+}
+
+template<typename F>
+struct Replayer;
+template<typename R, typename... A>
+struct Replayer<R(APIENTRY*)(A...)>
+{
+	using Function = R(APIENTRY*)(A...);
+
+	static void replay(void* function, const ReplayFlags& flags, TraceReader& reader, ReplayState& state)
+	{
+		replay(function, flags, reader, state, std::index_sequence_for<A...>{});
+	}
+	template<std::size_t... I>
+	static void replay(void* function, const ReplayFlags& flags, TraceReader& reader, ReplayState& state, std::index_sequence<I...>)
+	{
+		// Braced initialization evaluates left to right, the order the arguments were written
+		std::tuple<A...> arguments{ reader.template argument<A>()... };
+		Blob blobs[sizeof...(A) + 1]{};
+		std::uint8_t blobCount{ reader.template read<std::uint8_t>() };
+		for (std::uint8_t b{ 0 }; b < blobCount; ++b)
+		{
+			std::uint8_t index{ reader.template read<std::uint8_t>() };
+			GLTraceBlob kind{ reader.template read<GLTraceBlob>() };
+			std::uint32_t size{ reader.template read<std::uint32_t>() };
+			const char* data{ reader.bytes(size) };
+			if (index < sizeof...(A))
+				blobs[index] = Blob{ kind, data, size };
+		}
+		if (reader.failed())
+			return;
+		(resolvePointer(std::get<I>(arguments), blobs[I], state, flags), ...);
+		if constexpr (sizeof...(A) == 4)
+		{
+			if (flags.noLengths)
+				std::get<3>(arguments) = {};
+		}
+
+		Function call{ (Function)function };
+		if constexpr (std::is_void<R>::value)
+			call(std::get<I>(arguments)...);
+		else
+		{
+			R result{ call(std::get<I>(arguments)...) };
+			R recorded{ reader.template argument<R>() };
+			if constexpr (std::is_pointer<R>::value)
+				state.pointers[(std::uint64_t)(std::uintptr_t)recorded] = (std::uint64_t)(std::uintptr_t)result;
+			else if (flags.checkResult && result != recorded)
+				++state.mismatches;
+		}
+		// Generated names must match, later calls use the recorded ones
+		for (std::size_t i{ 0 }; i < sizeof...(A); ++i)
+		{
+			if (blobs[i].kind == GLTraceBlob::Output && blobs[i].data != nullptr && std::memcmp(blobs[i].data, state.scratch.data(), blobs[i].size) != 0)
+				++state.mismatches;
+		}
+		++state.calls;
+	}
+};
+
+// FUNCTION TABLE
+// --------------
+struct ReplayEntry
+{
+	void (*replay)(void* function, const ReplayFlags& flags, TraceReader& reader, ReplayState& state);
+	void* function;
+	ReplayFlags flags;
+};
+
+static ReplayFlags flagsFor(const std::string& name)
+{
+	ReplayFlags flags{};
+	flags.query = name.compare(0, 5, "glGet") == 0 || name.compare(0, 6, "glRead") == 0;
+	flags.checkResult = name.compare(0, 8, "glCreate") == 0 || name.find("Location") != std::string::npos || name.find("Index") != std::string::npos;
+	flags.noLengths = name == "glShaderSource";
+	return flags;
+}
+static std::unordered_map<std::string, ReplayEntry> buildFunctionTable()
+{
+	std::unordered_map<std::string, ReplayEntry> table{};
+#define GLAD_PROC(version, type, ret, name, params, args) \
+	table["gl" #name] = ReplayEntry{ &Replayer<type>::replay, (void*)glad_gl##name, flagsFor("gl" #name) };
+#include <glad/glad_procs.h>
+	return table;
+}
+
+// REPLAY LOOP
+// -----------
+struct ReplayResult
+{
+	double milliseconds{ 0.0 };
+	double recordedMilliseconds{ 0.0 }; // GL time the capturing process measured
+	std::vector<double> frames{};
+};
+
+static bool replayTrace(const std::vector<char>& trace, ReplayState& state, ReplayResult& result)
+{
+	TraceReader reader{ trace };
+	reader.rewind(sizeof(std::uint32_t) * 4);
+	std::unordered_map<std::string, ReplayEntry> table{ buildFunctionTable() };
+	std::vector<const ReplayEntry*> functions{};
+
+	Clock::time_point start{ Clock::now() };
+	Clock::time_point frameStart{ start };
+	while (!reader.done())
+	{
+		GLTraceRecord record{ reader.read<GLTraceRecord>() };
+		switch (record)
+		{
+		case GLTraceRecord::Function:
+		{
+			std::uint16_t id{ reader.read<std::uint16_t>() };
+			std::uint8_t length{ reader.read<std::uint8_t>() };
+			const char* name{ reader.bytes(length) };
+			if (name == nullptr)
+				break;
+			std::string functionName{ name, length };
+			auto found{ table.find(functionName) };
+			if (found == table.end() || found->second.function == nullptr)
+			{
+				std::cout << "The trace calls " << functionName << ", which this context does not have" << std::endl;
+				return false;
+			}
+			if (functions.size() <= id)
+				functions.resize((std::size_t)id + 1, nullptr);
+			functions[id] = &found->second;
+			break;
+		}
+		case GLTraceRecord::Call:
+		{
+			std::uint16_t id{ reader.read<std::uint16_t>() };
+			reader.read<std::uint64_t>();
+			result.recordedMilliseconds += reader.read<std::uint32_t>() / 1000000.0;
+			if (id >= functions.size() || functions[id] == nullptr)
+			{
+				std::cout << "Corrupt trace: call to undefined function " << id << std::endl;
+				return false;
+			}
+			const ReplayEntry& entry{ *functions[id] };
+			entry.replay(entry.function, entry.flags, reader, state);
+			break;
+		}
+		case GLTraceRecord::Frame:
+		{
+			// Headless contexts only flush on swap, so do the same
+			glFlush();
+			Clock::time_point now{ Clock::now() };
+			result.frames.push_back(std::chrono::duration<double, std::milli>(now - frameStart).count());
+			frameStart = now;
+			break;
+		}
+		case GLTraceRecord::Memory:
+		{
+			std::uint64_t pointer{ reader.read<std::uint64_t>() };
+			std::uint64_t length{ reader.read<std::uint64_t>() };
+			std::uint64_t offset{ reader.read<std::uint64_t>() };
+			std::uint32_t size{ reader.read<std::uint32_t>() };
+			const char* data{ reader.bytes(size) };
+			if (offset > length || size > length - offset)
+			{
+				std::cout << "Corrupt trace: write of " << size << " bytes at " << offset << " into a mapping of " << length << std::endl;
+				return false;
+			}
+			auto found{ state.pointers.find(pointer) };
+			if (data != nullptr && found != state.pointers.end() && found->second != 0)
+				std::memcpy((char*)(std::uintptr_t)found->second + offset, data, size);
+			break;
+		}
+		default:
+			std::cout << "Corrupt trace: unknown record " << (int)record << std::endl;
+			return false;
+		}
+	}
+	glFinish();
+	result.milliseconds = millisecondsSince(start);
+	if (reader.failed())
+	{
+		std::cout << "The trace ends in the middle of a record" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+// FORWARD DECLARATIONS
+// --------------------
+bool parseArguments(int argc, char* argv[], ReplayOptions& options);
+
+// MAIN
+// ----
+int main(int argc, char* argv[])
+{
+	ReplayOptions options{};
+	if (!parseArguments(argc, argv, options))
+		return -1;
+	std::ifstream file{ options.path, std::ios::binary };
+	if (!file)
+	{
+		std::cout << "Failed to open trace " << options.path << std::endl;
+		return -1;
+	}
+	std::vector<char> trace{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+	std::uint32_t header[4]{};
+	if (trace.size() < sizeof(header))
+	{
+		std::cout << options.path << " is not a GL trace" << std::endl;
+		return -1;
+	}
+	std::memcpy(header, trace.data(), sizeof(header));
+	if (header[0] != GL_TRACE_MAGIC || header[1] != GL_TRACE_VERSION)
+	{
+		std::cout << options.path << " is not a GL trace of version " << GL_TRACE_VERSION << std::endl;
+		return -1;
+	}
+	std::cout << "Replaying " << options.path << " (" << trace.size() / 1024 << " KiB, " << header[2] << "x" << header[3] << ")" << std::endl;
+
+	ReplayState state{};
+	state.scratch.resize(REPLAY_SCRATCH_SIZE);
+	for (int loop{ 0 }; loop < options.loops; ++loop)
+	{
+		// A fresh context per loop, the trace starts from one
+		ContextOptions contextOptions{};
+		contextOptions.backend = ContextBackend::Headless;
+		contextOptions.width = header[2] > 0 ? (int)header[2] : 800;
+		contextOptions.height = header[3] > 0 ? (int)header[3] : 800;
+		Context context{};
+		if (!context.create(contextOptions))
+			return -1;
+		state.pointers.clear();
+		state.calls = state.mismatches = state.unknownPointers = 0;
+		ReplayResult result{};
+		if (!replayTrace(trace, state, result))
+			return -1;
+		std::vector<double> frames{ result.frames };
+		std::sort(frames.begin(), frames.end());
+		double median{ frames.empty() ? 0.0 : frames[frames.size() / 2] };
+		double worst{ frames.empty() ? 0.0 : frames.back() };
+		std::cout << "Loop " << loop + 1 << ": " << state.calls << " calls, " << result.frames.size() << " frames in " << result.milliseconds
+			<< " ms (median frame " << median << " ms, worst " << worst << " ms; captured GL time " << result.recordedMilliseconds << " ms)" << std::endl;
+		if (loop == 0 && (state.mismatches > 0 || state.unknownPointers > 0))
+		{
+			std::cout << "  " << state.mismatches << " names or locations differ from the capture, " << state.unknownPointers
+				<< " client pointers replayed as zeroed memory; the replay may not match" << std::endl;
+		}
+		context.destroy();
+	}
+	return 0;
+}
+// PARSEARGUMENTS() IMPLEMENTATION
+// -------------------------------
+// <trace>              file written by GLTrace (OpenGL --trace <file>)
+// --loops <count>      replay the trace <count> times, each on a new context (3)
+bool parseArguments(int argc, char* argv[], ReplayOptions& options)
+{
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--loops") == 0 && i + 1 < argc)
+			options.loops = std::max(std::atoi(argv[++i]), 1);
+		else if (argv[i][0] != '-' && options.path.empty())
+			options.path = argv[i];
+		else
+		{
+			std::cout << "Unknown argument " << argv[i] << std::endl;
+			options.path.clear();
+			break;
+		}
+	}
+	if (options.path.empty())
+	{
+		std::cout << "Usage: Replay <trace> [--loops <count>]" << std::endl;
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,140 @@
+#include "RingBuffer.h"
+#include "FrameStats.h"
+#include "RenderState.h"
+#include <iostream>
+
+RingBuffer::~RingBuffer()
+{
+	destroy();
+}
+bool RingBuffer::create(RenderStateCache& state, GLenum target, GLsizeiptr frameSize, int framesInFlight)
+{
+	// The cache would skip binding a recycled name it still records as bound
+	if (m_buffer != 0)
+		state.bindBuffer(m_target, 0);
+	destroy();
+	if (framesInFlight < 1)
+		framesInFlight = 1;
+	if (framesInFlight > MAX_FRAMES_IN_FLIGHT)
+		framesInFlight = MAX_FRAMES_IN_FLIGHT;
+	m_target = target;
+	m_framesInFlight = framesInFlight;
+	m_minimumAlignment = 16;
+	if (target == GL_UNIFORM_BUFFER || target == GL_SHADER_STORAGE_BUFFER)
+	{
+		int alignment{ 0 };
+		glGetIntegerv(target == GL_UNIFORM_BUFFER ? GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT : GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		if (alignment > m_minimumAlignment)
+			m_minimumAlignment = alignment;
+	}
+	// Keep every region start aligned as well
+	m_frameSize = (frameSize + m_minimumAlignment - 1) / m_minimumAlignment * m_minimumAlignment;
+	GLsizeiptr totalSize{ m_frameSize * m_framesInFlight };
+
+	// glad only loads glBufferStorage with GL 4.4, so check the entry point rather than the extension
+	m_persistent = glBufferStorage != NULL;
+
+	// Bound through the cache: a raw bind of GL_ELEMENT_ARRAY_BUFFER would change the bound VAO
+	glGenBuffers(1, &m_buffer);
+	state.bindBuffer(target, m_buffer);
+	if (m_persistent)
+	{
+		GLbitfield flags{ GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT };
+		glBufferStorage(target, totalSize, NULL, flags);
+		m_memory = (unsigned char*)glMapBufferRange(target, 0, totalSize, flags);
+		if (m_memory == nullptr)
+		{
+			std::cout << "Ring buffer failed to map, falling back to buffer updates" << std::endl;
+			state.bindBuffer(target, 0);
+			glDeleteBuffers(1, &m_buffer);
+			glGenBuffers(1, &m_buffer);
+			state.bindBuffer(target, m_buffer);
+			m_persistent = false;
+		}
+	}
+	if (!m_persistent)
+	{
+		glBufferData(target, totalSize, NULL, GL_DYNAMIC_DRAW);
+		m_shadow.resize(totalSize);
+		m_memory = m_shadow.data();
+	}
+	m_frame = -1;
+	m_regionStart = m_head = m_flushed = 0;
+	return true;
+}
+void RingBuffer::destroy()
+{
+	for (GLsync& fence : m_fences)
+	{
+		if (fence != nullptr)
+			glDeleteSync(fence);
+		fence = nullptr;
+	}
+	if (m_buffer != 0)
+	{
+		// Deleting a buffer unmaps it
+		glDeleteBuffers(1, &m_buffer);
+	}
+	m_buffer = 0;
+	m_memory = nullptr;
+	m_shadow.clear();
+	m_shadow.shrink_to_fit();
+	m_frameSize = 0;
+	m_regionStart = m_head = m_flushed = 0;
+}
+// FRAMES
+// ------
+void RingBuffer::beginFrame()
+{
+	m_frame = (m_frame + 1) % m_framesInFlight;
+	m_regionStart = m_head = m_flushed = m_frame * m_frameSize;
+	GLsync& fence{ m_fences[m_frame] };
+	if (fence == nullptr)
+		return;
+	GLenum result{ glClientWaitSync(fence, 0, 0) };
+	if (result == GL_TIMEOUT_EXPIRED)
+	{
+		++m_stats.stalls;
+		// One second per wait; only a lost context keeps this spinning
+		do
+			result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+		while (result == GL_TIMEOUT_EXPIRED);
+	}
+	glDeleteSync(fence);
+	fence = nullptr;
+}
+void RingBuffer::endFrame()
+{
+	if (m_frame < 0)
+		return;
+	GLsync& fence{ m_fences[m_frame] };
+	if (fence != nullptr)
+		glDeleteSync(fence);
+	fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+// ALLOCATION
+// ----------
+RingAllocation RingBuffer::allocate(GLsizeiptr size, GLsizeiptr alignment)
+{
+	if (alignment < m_minimumAlignment)
+		alignment = m_minimumAlignment;
+	GLsizeiptr offset{ (m_head + alignment - 1) / alignment * alignment };
+	if (m_frame < 0 || offset + size > m_regionStart + m_frameSize)
+	{
+		++m_stats.overflows;
+		return RingAllocation{};
+	}
+	++m_stats.allocations;
+	countUpload(size);
+	m_head = offset + size;
+	return RingAllocation{ m_memory + offset, offset, size, m_buffer };
+}
+void RingBuffer::flush(RenderStateCache& state)
+{
+	// Coherent mappings need nothing, the GPU sees writes once the draw is issued
+	if (m_persistent || m_head == m_flushed)
+		return;
+	state.bindBuffer(m_target, m_buffer);
+	glBufferSubData(m_target, m_flushed, m_head - m_flushed, m_memory + m_flushed);
+	m_flushed = m_head;
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+
+class RenderStateCache;
+
+// RING ALLOCATION
+// ---------------
+// data is where the CPU writes, offset is where the GPU reads it in buffer.
+// data is nullptr when the frame's region is full.
+struct RingAllocation
+{
+	void* data{ nullptr };
+	GLintptr offset{ 0 };
+	GLsizeiptr size{ 0 };
+	unsigned int buffer{ 0 };
+};
+
+struct RingBufferStats
+{
+	long long allocations{ 0 };
+	long long overflows{ 0 }; // allocations that did not fit in the frame's region
+	long long stalls{ 0 };    // beginFrame() calls that had to wait for the GPU
+};
+
+// RING BUFFER
+// -----------
+// Per-frame streaming memory for dynamic vertices, uniforms and instance data.
+// One buffer is split into a region per frame in flight (three by default);
+// each frame hands out aligned sub-ranges of its region and endFrame() puts a
+// fence behind the draws that read them. A region is reused only after its
+// fence signals, so writes never race the GPU and the driver never needs to
+// copy or rename storage.
+// Uniform and storage rings align every allocation to the driver's offset
+// alignment for that binding point.
+// With GL 4.4 buffer storage the buffer is mapped once, persistent and
+// coherent, and allocations point straight into it. Without it allocations
+// point into a CPU shadow copy that flush() uploads with glBufferSubData.
+class RingBuffer
+{
+public:
+	~RingBuffer();
+	RingBuffer() = default;
+	RingBuffer(const RingBuffer&) = delete;
+	RingBuffer& operator=(const RingBuffer&) = delete;
+
+	bool create(RenderStateCache& state, GLenum target, GLsizeiptr frameSize, int framesInFlight = 3);
+	void destroy();
+
+	void beginFrame(); // moves to the next region, waits for the GPU if it is still reading it
+	RingAllocation allocate(GLsizeiptr size, GLsizeiptr alignment = 0);
+	void flush(RenderStateCache& state); // call before drawing from this frame's allocations
+	void endFrame();   // fences the current region
+
+	bool persistent() const { return m_persistent; }
+	GLsizeiptr frameSize() const { return m_frameSize; }
+	GLsizeiptr used() const { return m_head - m_regionStart; }
+	unsigned int buffer() const { return m_buffer; }
+	const RingBufferStats& stats() const { return m_stats; }
+
+private:
+	static constexpr int MAX_FRAMES_IN_FLIGHT{ 4 };
+
+	GLenum m_target{ 0 };
+	unsigned int m_buffer{ 0 };
+	GLsizeiptr m_frameSize{ 0 };
+	GLsizeiptr m_minimumAlignment{ 1 };
+	int m_framesInFlight{ 0 };
+	int m_frame{ -1 };
+	GLsizeiptr m_regionStart{ 0 };
+	GLsizeiptr m_head{ 0 };
+	GLsizeiptr m_flushed{ 0 };
+	bool m_persistent{ false };
+	unsigned char* m_memory{ nullptr };
+	std::vector<unsigned char> m_shadow{};
+	GLsync m_fences[MAX_FRAMES_IN_FLIGHT]{};
+	RingBufferStats m_stats{};
+};
@@ -0,0 +1,180 @@
+#include "ShaderManager.h"
+#include "ProgramCache.h"
+#include <iostream>
+#include <utility>
+
+// KHR_PARALLEL_SHADER_COMPILE
+// ---------------------------
+// Not part of the generated glad (no extensions were selected), so the entry
+// point and enums are declared here and loaded by hand.
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+
+ShaderManager::ShaderManager(GLADloadproc loader, ProgramCache* cache)
+	: m_cache{ cache }
+{
+	PFNGLMAXSHADERCOMPILERTHREADSKHRPROC maxShaderCompilerThreads{ NULL };
+	if (gladHasExtension("GL_KHR_parallel_shader_compile"))
+		maxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)loader("glMaxShaderCompilerThreadsKHR");
+	else if (gladHasExtension("GL_ARB_parallel_shader_compile"))
+		maxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)loader("glMaxShaderCompilerThreadsARB");
+	if (maxShaderCompilerThreads != NULL)
+	{
+		// 0xFFFFFFFF lets the driver pick as many threads as it likes
+		maxShaderCompilerThreads(0xFFFFFFFFu);
+		glGetIntegerv(GL_MAX_SHADER_COMPILER_THREADS_KHR, &m_stats.compilerThreads);
+		if (m_stats.compilerThreads == 0)
+			m_stats.compilerThreads = -1; // supported, but the driver does not report a count
+	}
+}
+ShaderManager::~ShaderManager()
+{
+	destroy();
+}
+void ShaderManager::destroy()
+{
+	for (Build& build : m_builds)
+	{
+		glDeleteShader(build.vertexShader);
+		glDeleteShader(build.fragmentShader);
+		glDeleteProgram(build.program);
+	}
+	m_builds.clear();
+}
+// SUBMIT
+// ------
+int ShaderManager::add(const char* name, const char* vertexSource, const char* fragmentSource)
+{
+	Build build{};
+	build.name = name;
+	if (m_cache != nullptr)
+	{
+		const char* sources[]{ vertexSource, fragmentSource };
+		build.cacheKey = m_cache->key(sources, 2);
+		build.program = m_cache->load(build.cacheKey);
+		if (build.program != 0)
+		{
+			build.state = BuildState::Ready;
+			++m_stats.cached;
+			m_builds.push_back(std::move(build));
+			return (int)m_builds.size() - 1;
+		}
+	}
+	// Issue everything and return, status queries would make the driver finish the compile
+	build.vertexShader = glCreateShader(GL_VERTEX_SHADER);
+	glShaderSource(build.vertexShader, 1, &vertexSource, NULL);
+	glCompileShader(build.vertexShader);
+	build.fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+	glShaderSource(build.fragmentShader, 1, &fragmentSource, NULL);
+	glCompileShader(build.fragmentShader);
+	build.program = glCreateProgram();
+	if (m_cache != nullptr && m_cache->enabled())
+		glProgramParameteri(build.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	glAttachShader(build.program, build.vertexShader);
+	glAttachShader(build.program, build.fragmentShader);
+	glLinkProgram(build.program);
+	++m_stats.submitted;
+	m_builds.push_back(std::move(build));
+	return (int)m_builds.size() - 1;
+}
+// COMPLETION
+// ----------
+bool ShaderManager::completed(const Build& build) const
+{
+	if (build.state != BuildState::Pending)
+		return true;
+	if (!parallelCompile())
+		return false;
+	int done{ GL_FALSE };
+	glGetProgramiv(build.program, GL_COMPLETION_STATUS_KHR, &done);
+	return done == GL_TRUE;
+}
+void ShaderManager::finalize(Build& build)
+{
+	if (build.state != BuildState::Pending)
+		return;
+	int success;
+	char infoLog[512];
+	glGetProgramiv(build.program, GL_LINK_STATUS, &success);
+	if (!success)
+	{
+		// Report the stage that broke, a failed compile shows up as a link failure
+		glGetShaderiv(build.vertexShader, GL_COMPILE_STATUS, &success);
+		if (!success)
+		{
+			glGetShaderInfoLog(build.vertexShader, 512, NULL, infoLog);
+			std::cout << build.name << ": Vertex shader compilation failed" << infoLog << std::endl;
+		}
+		glGetShaderiv(build.fragmentShader, GL_COMPILE_STATUS, &success);
+		if (!success)
+		{
+			glGetShaderInfoLog(build.fragmentShader, 512, NULL, infoLog);
+			std::cout << build.name << ": Fragment shader compilation failed" << infoLog << std::endl;
+		}
+		glGetProgramInfoLog(build.program, 512, NULL, infoLog);
+		std::cout << build.name << ": Failed to link shader program" << infoLog << std::endl;
+		glDeleteProgram(build.program);
+		build.program = 0;
+		build.state = BuildState::Failed;
+		++m_stats.failed;
+	}
+	else
+	{
+		build.state = BuildState::Ready;
+		if (m_cache != nullptr)
+			m_cache->store(build.cacheKey, build.program);
+	}
+	glDeleteShader(build.vertexShader);
+	glDeleteShader(build.fragmentShader);
+	build.vertexShader = build.fragmentShader = 0;
+}
+// QUERIES
+// -------
+unsigned int ShaderManager::program(int handle)
+{
+	Build& build{ m_builds[handle] };
+	if (build.state == BuildState::Pending)
+	{
+		if (!completed(build))
+			++m_stats.blockingWaits;
+		finalize(build);
+	}
+	return build.program;
+}
+// Without parallel compile there is no way to ask without waiting, so both
+// finalize (and block on) whatever is still pending
+bool ShaderManager::isReady(int handle)
+{
+	Build& build{ m_builds[handle] };
+	if (parallelCompile() && !completed(build))
+		return false;
+	finalize(build);
+	return true;
+}
+void ShaderManager::poll()
+{
+	for (Build& build : m_builds)
+	{
+		if (build.state == BuildState::Pending && (!parallelCompile() || completed(build)))
+			finalize(build);
+	}
+}
+void ShaderManager::finishAll()
+{
+	for (int i{ 0 }; i < (int)m_builds.size(); ++i)
+		program(i);
+}
+void ShaderManager::printStats() const
+{
+	std::cout << "Shader manager: " << m_stats.submitted << " compiled, " << m_stats.cached << " from cache, "
+		<< m_stats.failed << " failed, " << m_stats.blockingWaits << " blocking waits, ";
+	if (m_stats.compilerThreads > 0)
+		std::cout << m_stats.compilerThreads << " compiler threads" << std::endl;
+	else if (m_stats.compilerThreads < 0)
+		std::cout << "parallel compile" << std::endl;
+	else
+		std::cout << "serial compile" << std::endl;
+}
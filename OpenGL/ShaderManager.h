@@ -0,0 +1,76 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ProgramCache;
+
+// SHADER MANAGER STATISTICS
+// -------------------------
+struct ShaderManagerStats
+{
+	int submitted{ 0 };       // programs handed to the driver compiler
+	int cached{ 0 };          // programs restored from the program cache instead
+	int failed{ 0 };          // programs that did not compile or link
+	int blockingWaits{ 0 };   // program() calls that had to wait for the compiler
+	int compilerThreads{ 0 }; // 0 when KHR/ARB_parallel_shader_compile is unavailable
+};
+
+// SHADER MANAGER
+// --------------
+// Asynchronous program builds: add() only issues glCompileShader/glLinkProgram
+// and returns a handle, nothing asks the driver for a status until the program
+// is actually needed. With KHR_parallel_shader_compile the driver compiles on
+// its own threads and isReady()/poll() can check GL_COMPLETION_STATUS_KHR
+// without stalling; without it compiles still overlap with the rest of startup
+// on drivers that defer work, and isReady()/poll() finalize pending builds
+// right away, waiting like program() does. program() finalizes a handle
+// (waiting if needed), prints the info log on failure and stores new binaries
+// in the ProgramCache. Call destroy() while the context is still current.
+class ShaderManager
+{
+public:
+	ShaderManager(GLADloadproc loader, ProgramCache* cache = nullptr);
+	~ShaderManager();
+	ShaderManager(const ShaderManager&) = delete;
+	ShaderManager& operator=(const ShaderManager&) = delete;
+
+	void destroy(); // deletes every program, handles become invalid
+
+	int add(const char* name, const char* vertexSource, const char* fragmentSource);
+
+	unsigned int program(int handle); // blocks until linked, 0 if the build failed
+	bool isReady(int handle);         // never blocks when parallel compile is available, otherwise waits
+	void poll();                      // finalize every build that has completed (all of them without parallel compile)
+	void finishAll();
+
+	bool parallelCompile() const { return m_stats.compilerThreads != 0; }
+	const ShaderManagerStats& stats() const { return m_stats; }
+	void printStats() const;
+
+private:
+	enum class BuildState
+	{
+		Pending,
+		Ready,
+		Failed
+	};
+
+	struct Build
+	{
+		std::string name;
+		std::uint64_t cacheKey{ 0 };
+		unsigned int vertexShader{ 0 };
+		unsigned int fragmentShader{ 0 };
+		unsigned int program{ 0 };
+		BuildState state{ BuildState::Pending };
+	};
+
+	bool completed(const Build& build) const;
+	void finalize(Build& build);
+
+	ProgramCache* m_cache;
+	std::vector<Build> m_builds{};
+	ShaderManagerStats m_stats{};
+};
@@ -0,0 +1,808 @@
+#include "AssetLoader.h"
+#include "BufferHeap.h"
+#include "CommandList.h"
+#include "JobSystem.h"
+#include "MeshOptimizer.h"
+#include "Profiler.h"
+#include "RenderQueue.h"
+#include "VertexFormat.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+// TEST HARNESS
+// ------------
+// Behavior tests for the parts of the engine that run without a GL context,
+// registered with CTest one group at a time. Run "Tests" for all of them or
+// "Tests <name>..." for a subset; a failed CHECK prints its location and the
+// group keeps going so one run shows every failure.
+struct Test
+{
+	const char* name;
+	const char* description;
+	bool (*run)();
+};
+
+static int checkFailures{ 0 };
+
+#define CHECK(condition) \
+	do \
+	{ \
+		if (!(condition)) \
+		{ \
+			std::cout << "  " << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed" << std::endl; \
+			++checkFailures; \
+		} \
+	} while (false)
+
+// GL DISPATCH
+// -----------
+// A fake driver: GL 3.3 with one extension and only glClear and glGetError
+// besides what glad needs to load, so the dispatch stubs run without a context
+static std::atomic<int> fakeClears{ 0 };
+static const char* fakeVersion{ "3.3 Fake" };
+static const GLubyte* APIENTRY fakeGetString(GLenum name)
+{
+	return (const GLubyte*)(name == GL_VERSION ? fakeVersion : "Fake");
+}
+static const GLubyte* APIENTRY fakeGetStringi(GLenum, GLuint)
+{
+	return (const GLubyte*)"GL_ARB_fake";
+}
+static void APIENTRY fakeGetIntegerv(GLenum name, GLint* data)
+{
+	*data = name == GL_NUM_EXTENSIONS ? 1 : 0;
+}
+static void APIENTRY fakeClear(GLbitfield)
+{
+	++fakeClears;
+}
+static GLenum APIENTRY fakeGetError()
+{
+	return GL_INVALID_OPERATION;
+}
+static void* fakeLoad(const char* name)
+{
+	if (std::strcmp(name, "glGetString") == 0)
+		return (void*)fakeGetString;
+	if (std::strcmp(name, "glGetStringi") == 0)
+		return (void*)fakeGetStringi;
+	if (std::strcmp(name, "glGetIntegerv") == 0)
+		return (void*)fakeGetIntegerv;
+	if (std::strcmp(name, "glClear") == 0)
+		return (void*)fakeClear;
+	if (std::strcmp(name, "glGetError") == 0)
+		return (void*)fakeGetError;
+	return nullptr;
+}
+static bool testDispatch()
+{
+	GladGLContext table{};
+	CHECK(gladLoadGLContext(&table, fakeLoad));
+	CHECK(table.major == 3 && table.minor == 3);
+	CHECK(gladContextHasExtension(&table, "GL_ARB_fake"));
+	gladMakeContextCurrent(&table);
+	gladUseContextDispatch();
+	CHECK(GLVersion.major == 3 && GLVersion.minor == 3);
+	CHECK(GLAD_GL_VERSION_3_3 && !GLAD_GL_VERSION_4_0);
+	CHECK(gladHasExtension("GL_ARB_fake"));
+
+	// Entries the table lacks stay NULL, so capability checks still work
+	CHECK(glClear != NULL);
+	CHECK(glDrawArrays == NULL);
+	CHECK(glDispatchCompute == NULL);
+	glClear(GL_COLOR_BUFFER_BIT);
+	CHECK(fakeClears.load() == 1);
+	CHECK(glGetError() == GL_INVALID_OPERATION);
+
+	// A thread without a table: calls do nothing and return 0
+	GLenum error{ GL_INVALID_OPERATION };
+	std::thread{ [&error] { glClear(GL_COLOR_BUFFER_BIT); error = glGetError(); } }.join();
+	CHECK(error == GL_NO_ERROR);
+	CHECK(fakeClears.load() == 1);
+
+	// A newer context enabling dispatch on another thread keeps the shared version
+	fakeVersion = "4.1 Fake";
+	bool newer{ false };
+	std::thread{ [&newer]
+	{
+		GladGLContext other{};
+		if (gladLoadGLContext(&other, fakeLoad))
+		{
+			gladMakeContextCurrent(&other);
+			gladUseContextDispatch();
+			newer = other.major == 4 && other.minor == 1;
+			gladFreeGLContext(&other);
+		}
+	} }.join();
+	fakeVersion = "3.3 Fake";
+	CHECK(newer);
+	CHECK(GLVersion.major == 3 && GLVersion.minor == 3);
+	CHECK(GLAD_GL_VERSION_3_3 && !GLAD_GL_VERSION_4_0);
+	CHECK(glClear != NULL);
+
+	// Freeing the table on this thread detaches it from every thread
+	std::atomic<int> stage{ 0 };
+	bool detached{ false };
+	std::thread worker{ [&]
+	{
+		gladMakeContextCurrent(&table);
+		glClear(GL_COLOR_BUFFER_BIT);
+		stage = 1;
+		while (stage.load() != 2)
+			std::this_thread::yield();
+		glClear(GL_COLOR_BUFFER_BIT);
+		detached = gladGetCurrentContext() == nullptr;
+	} };
+	while (stage.load() != 1)
+		std::this_thread::yield();
+	gladFreeGLContext(&table);
+	std::memset((void*)&table, 0, sizeof(table));
+	stage = 2;
+	worker.join();
+	CHECK(detached);
+	CHECK(fakeClears.load() == 2);
+	CHECK(gladGetCurrentContext() == nullptr);
+	glClear(GL_COLOR_BUFFER_BIT);
+	CHECK(fakeClears.load() == 2);
+	return checkFailures == 0;
+}
+
+// RENDER QUEUE
+// ------------
+static DrawItem queueItem(unsigned int program, unsigned int vertexArray, float depth, int first)
+{
+	DrawItem item{};
+	item.key = makeSortKey(0, program, 0, vertexArray, depth);
+	item.program = program;
+	item.vertexArray = vertexArray;
+	item.first = first;
+	item.count = 3;
+	return item;
+}
+static bool testQueue()
+{
+	// Fields are ordered pass, program, material, vertex array, depth
+	CHECK(makeSortKey(1, 0, 0, 0, 0.0f) > makeSortKey(0, 0xFFF, 0xFFFF, 0xFFF, 1.0f));
+	CHECK(makeSortKey(0, 2, 0, 0, 0.0f) > makeSortKey(0, 1, 0xFFFF, 0xFFF, 1.0f));
+	CHECK(makeSortKey(0, 1, 0, 5, 0.25f) < makeSortKey(0, 1, 0, 5, 0.75f));
+	CHECK(makeSortKey(0, 1, 0, 5, -3.0f) == makeSortKey(0, 1, 0, 5, 0.0f));
+	CHECK(makeSortKey(0, 1, 0, 5, 7.0f) == makeSortKey(0, 1, 0, 5, 1.0f));
+	CHECK(makeSortKey(0, 0x1001, 0, 0, 0.0f) == makeSortKey(0, 1, 0, 0, 0.0f));
+
+	RenderQueue queue{};
+	std::mt19937 random{ 7 };
+	std::uniform_int_distribution<unsigned int> programs{ 1, 40 };
+	std::uniform_real_distribution<float> depths{ 0.0f, 1.0f };
+	const int count{ 5000 };
+	std::vector<std::uint64_t> keys{};
+	for (int i{ 0 }; i < count; ++i)
+	{
+		DrawItem item{ queueItem(programs(random), programs(random), depths(random), i) };
+		keys.push_back(item.key);
+		queue.submit(item);
+	}
+	queue.sort();
+	std::sort(keys.begin(), keys.end());
+	CHECK(queue.size() == count);
+	bool ordered{ true };
+	for (int i{ 0 }; i < count; ++i)
+		ordered = ordered && queue.sorted(i).key == keys[i];
+	CHECK(ordered);
+
+	// Equal keys keep their submission order (the radix sort is stable)
+	queue.clear();
+	for (int i{ 0 }; i < 10; ++i)
+		queue.submit(queueItem(1, 1, 0.5f, i));
+	queue.sort();
+	bool stable{ true };
+	for (int i{ 0 }; i < 10; ++i)
+		stable = stable && queue.sorted(i).first == i;
+	CHECK(stable);
+	queue.clear();
+	CHECK(queue.size() == 0);
+
+	// Adjacent ranges merge for list primitives only
+	DrawItem first{ queueItem(1, 1, 0.5f, 0) };
+	DrawItem second{ queueItem(1, 1, 0.5f, 3) };
+	CHECK(canMerge(first, 3, second));
+	CHECK(!canMerge(first, 6, second));
+	for (GLenum mode : { GL_LINES, GL_POINTS })
+	{
+		first.mode = second.mode = mode;
+		CHECK(canMerge(first, 3, second));
+	}
+	for (GLenum mode : { GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN, GL_LINE_STRIP, GL_LINE_LOOP })
+	{
+		first.mode = second.mode = mode;
+		CHECK(!canMerge(first, 3, second));
+	}
+	first.mode = second.mode = GL_TRIANGLES;
+	second.texture = 4;
+	CHECK(!canMerge(first, 3, second));
+	second.texture = 0;
+	second.instanceCount = 2;
+	CHECK(!canMerge(first, 3, second));
+	return checkFailures == 0;
+}
+
+// OFFSET ALLOCATOR
+// ----------------
+static bool testHeap()
+{
+	OffsetAllocator allocator{};
+	allocator.reset(100);
+	CHECK(allocator.allocate(0) == OffsetAllocator::INVALID);
+	CHECK(allocator.allocate(101) == OffsetAllocator::INVALID);
+	std::uint32_t a{ allocator.allocate(10) };
+	std::uint32_t b{ allocator.allocate(20) };
+	std::uint32_t c{ allocator.allocate(30) };
+	CHECK(a == 0 && b == 10 && c == 30);
+	CHECK(allocator.stats().used == 60);
+	CHECK(allocator.stats().largestFree == 40);
+
+	// Best fit takes the 10 unit hole, not the 40 unit tail
+	allocator.free(a);
+	CHECK(allocator.stats().freeRanges == 2);
+	CHECK(allocator.allocate(8) == 0);
+	CHECK(allocator.stats().largestFree == 40);
+
+	// Freeing neighbours merges them back into one range
+	allocator.free(0);
+	allocator.free(b);
+	CHECK(allocator.stats().freeRanges == 2);
+	allocator.free(c);
+	OffsetAllocatorStats stats{ allocator.stats() };
+	CHECK(stats.freeRanges == 1 && stats.largestFree == 100 && stats.used == 0 && stats.allocations == 0);
+	CHECK(stats.fragmentation() == 0.0f);
+
+	// Random churn never hands out overlapping ranges and always returns to one range
+	allocator.reset(4096);
+	std::mt19937 random{ 3 };
+	std::vector<std::pair<std::uint32_t, std::uint32_t>> live{};
+	bool overlapping{ false };
+	for (int step{ 0 }; step < 4000; ++step)
+	{
+		if (!live.empty() && random() % 3 == 0)
+		{
+			std::size_t victim{ random() % live.size() };
+			allocator.free(live[victim].first);
+			live.erase(live.begin() + victim);
+			continue;
+		}
+		std::uint32_t size{ (std::uint32_t)(1 + random() % 64) };
+		std::uint32_t offset{ allocator.allocate(size) };
+		if (offset == OffsetAllocator::INVALID)
+			continue;
+		for (const auto& range : live)
+			overlapping = overlapping || (offset < range.first + range.second && range.first < offset + size);
+		overlapping = overlapping || offset + size > 4096;
+		live.emplace_back(offset, size);
+	}
+	CHECK(!overlapping);
+	for (const auto& range : live)
+		allocator.free(range.first);
+	stats = allocator.stats();
+	CHECK(stats.freeRanges == 1 && stats.used == 0);
+	return checkFailures == 0;
+}
+
+// MESH OPTIMIZER
+// --------------
+// A size x size grid of quads as a triangle soup, positions only
+static std::vector<float> gridSoup(int size)
+{
+	std::vector<float> soup{};
+	auto corner{ [&](int x, int y) { soup.insert(soup.end(), { (float)x, (float)y, 0.0f }); } };
+	for (int y{ 0 }; y < size; ++y)
+	{
+		for (int x{ 0 }; x < size; ++x)
+		{
+			corner(x, y); corner(x + 1, y); corner(x + 1, y + 1);
+			corner(x, y); corner(x + 1, y + 1); corner(x, y + 1);
+		}
+	}
+	return soup;
+}
+// Triangles by position, rotated to start at their smallest corner so the
+// winding is kept, sorted so the order does not matter
+static std::vector<std::array<float, 9>> triangleSet(const IndexedMesh& mesh)
+{
+	std::vector<std::array<float, 9>> triangles{};
+	for (std::uint32_t t{ 0 }; t < mesh.triangleCount(); ++t)
+	{
+		std::array<std::array<float, 3>, 3> corners{};
+		for (int c{ 0 }; c < 3; ++c)
+		{
+			const float* vertex{ &mesh.vertices[(std::size_t)mesh.indices[t * 3 + c] * mesh.floatsPerVertex] };
+			corners[c] = { vertex[0], vertex[1], vertex[2] };
+		}
+		int first{ (int)(std::min_element(corners.begin(), corners.end()) - corners.begin()) };
+		std::array<float, 9> triangle{};
+		for (int c{ 0 }; c < 3; ++c)
+			std::copy(corners[(first + c) % 3].begin(), corners[(first + c) % 3].end(), triangle.begin() + c * 3);
+		triangles.push_back(triangle);
+	}
+	std::sort(triangles.begin(), triangles.end());
+	return triangles;
+}
+static bool testMesh()
+{
+	const int size{ 32 };
+	std::vector<float> soup{ gridSoup(size) };
+	std::uint32_t soupVertices{ (std::uint32_t)(soup.size() / 3) };
+	IndexedMesh mesh{ indexTriangles(soup.data(), soupVertices, 3) };
+	CHECK(mesh.vertexCount() == (std::uint32_t)((size + 1) * (size + 1)));
+	CHECK(mesh.triangleCount() == (std::uint32_t)(size * size * 2));
+	std::vector<std::array<float, 9>> input{ triangleSet(mesh) };
+
+	// The soup transforms every vertex of every triangle
+	IndexedMesh unindexed{};
+	unindexed.vertices = soup;
+	for (std::uint32_t i{ 0 }; i < soupVertices; ++i)
+		unindexed.indices.push_back(i);
+	VertexCacheStats soupStats{ analyzeVertexCache(unindexed) };
+	CHECK(soupStats.acmr == 3.0f && soupStats.atvr == 1.0f);
+
+	// optimizeMesh reports against the soup it was given, before deduplicating
+	IndexedMesh optimized{ unindexed };
+	MeshOptimizationReport report{ optimizeMesh(optimized) };
+	CHECK(report.inputVertices == soupVertices && report.uniqueVertices == mesh.vertexCount());
+	CHECK(report.before.acmr == 3.0f && report.after.acmr < 1.0f);
+	CHECK(triangleSet(optimized) == input);
+
+	// Scramble the triangle order, then let the passes recover the locality
+	std::mt19937 random{ 11 };
+	std::vector<std::uint32_t> order(mesh.triangleCount());
+	for (std::uint32_t t{ 0 }; t < order.size(); ++t)
+		order[t] = t;
+	std::shuffle(order.begin(), order.end(), random);
+	std::vector<std::uint32_t> shuffled{};
+	for (std::uint32_t t : order)
+		shuffled.insert(shuffled.end(), mesh.indices.begin() + t * 3, mesh.indices.begin() + t * 3 + 3);
+	mesh.indices.swap(shuffled);
+	VertexCacheStats scrambled{ analyzeVertexCache(mesh) };
+
+	optimizeVertexCache(mesh);
+	VertexCacheStats tipsy{ analyzeVertexCache(mesh) };
+	CHECK(tipsy.acmr < scrambled.acmr);
+	CHECK(tipsy.acmr < 1.0f);
+	CHECK(triangleSet(mesh) == input);
+
+	optimizeOverdraw(mesh);
+	CHECK(analyzeVertexCache(mesh).acmr <= tipsy.acmr * 1.05f + 0.001f);
+	CHECK(triangleSet(mesh) == input);
+
+	// Vertices end up numbered in first-use order
+	optimizeVertexFetch(mesh);
+	std::uint32_t next{ 0 };
+	bool firstUse{ true };
+	for (std::uint32_t index : mesh.indices)
+	{
+		if (index == next)
+			++next;
+		firstUse = firstUse && index < next;
+	}
+	CHECK(firstUse && next == mesh.vertexCount());
+	CHECK(triangleSet(mesh) == input);
+	return checkFailures == 0;
+}
+
+// VERTEX FORMATS
+// --------------
+static bool testVertexFormat()
+{
+	// Exactly representable values survive the round trip
+	const float exact[]{ 0.0f, 1.0f, -2.0f, 0.5f, 65504.0f, -0.000061035156f, 0.000000059604645f };
+	for (float value : exact)
+		CHECK(halfToFloat(floatToHalf(value)) == value);
+	CHECK(floatToHalf(1.0f) == 0x3C00);
+	CHECK(floatToHalf(-0.0f) == 0x8000);
+	CHECK(floatToHalf(65520.0f) == 0x7C00);
+	CHECK(floatToHalf(INFINITY) == 0x7C00);
+	CHECK(std::isnan(halfToFloat(floatToHalf(NAN))));
+	// Round to nearest even: 1 + 2^-11 is halfway between 1 and the next half
+	CHECK(floatToHalf(1.00048828125f) == 0x3C00);
+	CHECK(floatToHalf(1.00146484375f) == 0x3C02);
+	// Everything else within half a unit in the last place (11 significant bits)
+	std::mt19937 random{ 5 };
+	std::uniform_real_distribution<float> values{ -1000.0f, 1000.0f };
+	float worst{ 0.0f };
+	for (int i{ 0 }; i < 10000; ++i)
+	{
+		float value{ values(random) };
+		worst = std::max(worst, std::fabs(halfToFloat(floatToHalf(value)) - value) / std::fabs(value));
+	}
+	CHECK(worst <= 1.0f / 2048.0f);
+
+	CHECK(floatToSnorm16(1.0f) == 32767);
+	CHECK(floatToSnorm16(-1.0f) == -32767);
+	CHECK(floatToSnorm16(0.0f) == 0);
+	CHECK(floatToSnorm16(4.0f) == 32767);
+	CHECK(floatToSnorm16(-4.0f) == -32767);
+
+	// Octahedral encoding maps unit vectors into [-1, 1]^2 and back
+	std::normal_distribution<float> gaussian{};
+	float worstAngle{ 1.0f };
+	bool inRange{ true };
+	for (int i{ 0 }; i < 10000; ++i)
+	{
+		float normal[3]{ gaussian(random), gaussian(random), gaussian(random) };
+		if (i < 6)
+		{
+			normal[0] = normal[1] = normal[2] = 0.0f;
+			normal[i / 2] = i % 2 == 0 ? 1.0f : -1.0f;
+		}
+		float length{ std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]) };
+		for (float& component : normal)
+			component /= length;
+		float encoded[2];
+		octahedralEncode(normal, encoded);
+		inRange = inRange && std::fabs(encoded[0]) <= 1.0f && std::fabs(encoded[1]) <= 1.0f;
+		float quantized[2]{ floatToSnorm16(encoded[0]) / 32767.0f, floatToSnorm16(encoded[1]) / 32767.0f };
+		float decoded[3];
+		octahedralDecode(quantized, decoded);
+		worstAngle = std::min(worstAngle, decoded[0] * normal[0] + decoded[1] * normal[1] + decoded[2] * normal[2]);
+	}
+	CHECK(inRange);
+	CHECK(worstAngle > 0.99999f);
+
+	// Packed layouts have the documented strides
+	CHECK(VertexLayout::full().stride() == 32);
+	CHECK(VertexLayout::compressed().stride() == 16);
+	const float positions[]{ -4.0f, 0.0f, 2.0f, 4.0f, 8.0f, 2.0f };
+	VertexSource source{};
+	source.positions = positions;
+	source.count = 2;
+	VertexLayout snorm{};
+	snorm.add(VertexSemantic::Position, 0, VertexFormat::Snorm16x4);
+	PackedVertices packed{ snorm.pack(source) };
+	CHECK(packed.data.size() == 2 * 8);
+	const std::int16_t* stored{ (const std::int16_t*)packed.data.data() };
+	bool rebuilt{ true };
+	for (int v{ 0 }; v < 2; ++v)
+	{
+		for (int c{ 0 }; c < 3; ++c)
+		{
+			float position{ stored[v * 4 + c] / 32767.0f * packed.positionScale[c] + packed.positionOffset[c] };
+			rebuilt = rebuilt && std::fabs(position - positions[v * 3 + c]) < 0.001f;
+		}
+	}
+	CHECK(rebuilt);
+	return checkFailures == 0;
+}
+
+// JOB SYSTEM
+// ----------
+static void spawnChildren(JobSystem& jobs, std::atomic<int>& visited, int depth)
+{
+	visited.fetch_add(1, std::memory_order_relaxed);
+	if (depth == 0)
+		return;
+	JobCounter children{};
+	for (int i{ 0 }; i < 2; ++i)
+		jobs.run(children, [&jobs, &visited, depth] { spawnChildren(jobs, visited, depth - 1); });
+	jobs.wait(children);
+}
+static bool testJobs()
+{
+	// The owner pops newest first, thieves take the oldest
+	static JobDeque deque{};
+	Job jobs[3]{};
+	for (Job& job : jobs)
+		CHECK(deque.push(&job));
+	CHECK(deque.steal() == &jobs[0]);
+	CHECK(deque.pop() == &jobs[2]);
+	CHECK(deque.pop() == &jobs[1]);
+	CHECK(deque.pop() == nullptr);
+	CHECK(deque.steal() == nullptr);
+	CHECK(deque.empty());
+
+	// Owner and thieves racing: every job is taken exactly once
+	const int jobCount{ 200000 };
+	std::vector<Job> pool(jobCount);
+	std::vector<std::atomic<int>> taken(jobCount);
+	std::atomic<bool> done{ false };
+	auto take{ [&](Job* job) { taken[job - pool.data()].fetch_add(1, std::memory_order_relaxed); } };
+	std::vector<std::thread> thieves{};
+	for (int t{ 0 }; t < 3; ++t)
+	{
+		thieves.emplace_back([&]
+		{
+			while (!done.load(std::memory_order_acquire))
+			{
+				if (Job* job{ deque.steal() })
+					take(job);
+			}
+		});
+	}
+	for (int i{ 0 }; i < jobCount; ++i)
+	{
+		while (!deque.push(&pool[i]))
+		{
+			if (Job* job{ deque.pop() })
+				take(job);
+		}
+		if (i % 3 == 0)
+		{
+			if (Job* job{ deque.pop() })
+				take(job);
+		}
+	}
+	while (Job* job{ deque.pop() })
+		take(job);
+	done.store(true, std::memory_order_release);
+	for (std::thread& thief : thieves)
+		thief.join();
+	CHECK(deque.empty());
+	CHECK(std::all_of(taken.begin(), taken.end(), [](const std::atomic<int>& count) { return count.load() == 1; }));
+
+	// parallelFor covers the range exactly once, nested jobs all run before wait() returns
+	JobSystem system{};
+	CHECK(system.create(3));
+	std::vector<std::atomic<int>> hits(100000);
+	system.parallelFor(0, hits.size(), 64, [&](std::size_t begin, std::size_t end)
+	{
+		for (std::size_t i{ begin }; i < end; ++i)
+			hits[i].fetch_add(1, std::memory_order_relaxed);
+	});
+	CHECK(std::all_of(hits.begin(), hits.end(), [](const std::atomic<int>& hit) { return hit.load() == 1; }));
+	std::atomic<int> visited{ 0 };
+	spawnChildren(system, visited, 12);
+	CHECK(visited.load() == (1 << 13) - 1);
+	CHECK(system.stats().executed > 0);
+	system.destroy();
+
+	// Without workers everything runs inline
+	std::atomic<int> inlineRuns{ 0 };
+	JobSystem idle{};
+	JobCounter counter{};
+	idle.run(counter, [&inlineRuns] { ++inlineRuns; });
+	idle.parallelFor(0, 10, 1, [&inlineRuns](std::size_t begin, std::size_t end) { inlineRuns += (int)(end - begin); });
+	CHECK(counter.done() && inlineRuns.load() == 11);
+	return checkFailures == 0;
+}
+
+// COMMAND ARENA AND RECORDING
+// ---------------------------
+static bool testCommands()
+{
+	CommandArena arena{ 100 };
+	void* a{ arena.allocate(3) };
+	void* b{ arena.allocate(5) };
+	CHECK((std::uintptr_t)a % 8 == 0 && (std::uintptr_t)b % 8 == 0);
+	CHECK((unsigned char*)b - (unsigned char*)a == 8);
+	CHECK(arena.blockCount() == 1 && arena.bytesReserved() == 104);
+	// Too big for the rest of the block: a new block, the old one keeps its bytes
+	arena.allocate(100);
+	CHECK(arena.blockCount() == 2 && arena.bytesUsed() == 16 + 104);
+	// Bigger than a block: a block of its own
+	arena.allocate(1000);
+	CHECK(arena.blockCount() == 3 && arena.blockUsed(2) == 1000);
+	std::size_t reserved{ arena.bytesReserved() };
+
+	// Reset rewinds and the same traffic allocates nothing new
+	arena.reset();
+	CHECK(arena.bytesUsed() == 0);
+	CHECK(arena.allocate(3) == a);
+	arena.allocate(5);
+	arena.allocate(100);
+	arena.allocate(1000);
+	CHECK(arena.blockCount() == 3 && arena.bytesReserved() == reserved);
+
+	CommandList list{ 256 };
+	DrawItem item{};
+	item.count = 3;
+	const float matrix[16]{};
+	for (int i{ 0 }; i < 100; ++i)
+	{
+		list.useProgram(1);
+		list.setUniform(0, 1.0f, 0.0f, 0.0f, 1.0f);
+		list.setUniformMatrix4(1, matrix);
+		list.draw(item);
+	}
+	CHECK(list.size() == 400);
+	CHECK(list.bytes() % 8 == 0);
+	std::size_t bytes{ list.bytes() };
+	list.reset();
+	CHECK(list.size() == 0 && list.bytes() == 0);
+	list.useProgram(1);
+	CHECK(list.bytes() > 0 && list.bytes() < bytes);
+	return checkFailures == 0;
+}
+
+// ASSET DECODERS
+// --------------
+static std::vector<char> fileBytes(const std::string& text)
+{
+	return std::vector<char>(text.begin(), text.end());
+}
+static bool decodeObjText(const std::string& text, IndexedMesh& mesh)
+{
+	return AssetLoader::decodeObj(fileBytes(text), mesh);
+}
+static bool testDecoders()
+{
+	const std::string triangle{ "v 0 0 0\nv 1 0 0\nv 0 1 0\n" };
+	IndexedMesh mesh{};
+
+	// Positions only, the most common form: normals are generated
+	CHECK(decodeObjText(triangle + "f 1 2 3\n", mesh));
+	CHECK(mesh.floatsPerVertex == MESH_FLOATS_PER_VERTEX && mesh.vertexCount() == 3 && mesh.triangleCount() == 1);
+	bool generated{ true };
+	for (std::uint32_t v{ 0 }; v < mesh.vertexCount(); ++v)
+	{
+		const float* vertex{ &mesh.vertices[(std::size_t)v * MESH_FLOATS_PER_VERTEX] };
+		generated = generated && vertex[3] == 0.0f && vertex[4] == 0.0f && vertex[5] == 1.0f && vertex[6] == 0.0f && vertex[7] == 0.0f;
+	}
+	CHECK(generated);
+	std::vector<float> plain{ mesh.vertices };
+	CHECK(decodeObjText("v 0 0 0\r\nv 1 0 0\r\nv 0 1 0\r\nf 1 2 3\r\n", mesh) && mesh.vertices == plain);
+
+	// Negative indices count back from the last element defined so far
+	CHECK(decodeObjText(triangle + "f -3 -2 -1\n", mesh) && mesh.vertices == plain);
+
+	// position/uv and position//normal
+	CHECK(decodeObjText(triangle + "vt 0.25 0.75\nf 1/1 2/1 3/1\n", mesh));
+	CHECK(mesh.vertexCount() == 3 && mesh.vertices[6] == 0.25f && mesh.vertices[7] == 0.75f && mesh.vertices[5] == 1.0f);
+	CHECK(decodeObjText(triangle + "vn 0 0 -1\nf 1//1 2//1 3//1\n", mesh));
+	CHECK(mesh.vertexCount() == 3 && mesh.vertices[5] == -1.0f && mesh.vertices[6] == 0.0f);
+	CHECK(decodeObjText(triangle + "vt 0.5 0.5\nvn 1 0 0\nf 1/1/1 2/1/1 3/1/1\n", mesh));
+	CHECK(mesh.vertices[3] == 1.0f && mesh.vertices[6] == 0.5f);
+
+	// Polygons fan into triangles, vertices shared between faces are merged
+	CHECK(decodeObjText(triangle + "v 1 1 0\nf 1 2 4 3\n", mesh));
+	CHECK(mesh.vertexCount() == 4 && mesh.triangleCount() == 2);
+	CHECK(decodeObjText(triangle + "v 1 1 0\nf 1 2 4\nf 1 4 3\n", mesh));
+	CHECK(mesh.vertexCount() == 4 && mesh.triangleCount() == 2);
+	// The same position with another UV is another vertex
+	CHECK(decodeObjText(triangle + "vt 0 0\nvt 1 1\nf 1/1 2/1 3/1\nf 1/2 3/2 2/2\n", mesh));
+	CHECK(mesh.vertexCount() == 6);
+
+	// Out of range and malformed faces are rejected, not read out of bounds
+	CHECK(!decodeObjText(triangle + "f 1 2 4\n", mesh));
+	CHECK(!decodeObjText(triangle + "f 0 1 2\n", mesh));
+	CHECK(!decodeObjText(triangle + "f -4 -2 -1\n", mesh));
+	CHECK(!decodeObjText(triangle + "f 1/1 2/1 3/1\n", mesh));
+	CHECK(!decodeObjText(triangle + "vt 0 0\nf 1/2 2/1 3/1\n", mesh));
+	CHECK(!decodeObjText(triangle + "f 1//1 2//1 3//1\n", mesh));
+	CHECK(!decodeObjText("f 1 2 3\n" + triangle, mesh));
+	CHECK(!decodeObjText(triangle + "f 1 2\n", mesh));
+	CHECK(!decodeObjText(triangle + "f 1 x 3\n", mesh));
+	CHECK(!decodeObjText(triangle, mesh));
+
+	// PNM: RGB and grey, scaled to 8 bits, with a box filtered mip chain
+	AssetLoader::DecodedImage image{};
+	std::string rgb{ "P6\n# comment\n2 2\n255\n" };
+	const unsigned char pixels[12]{ 255, 0, 0, 0, 255, 0, 0, 0, 255, 255, 255, 255 };
+	rgb.append((const char*)pixels, sizeof(pixels));
+	CHECK(AssetLoader::decodeImage(fileBytes(rgb), image));
+	CHECK(image.width == 2 && image.height == 2 && image.levels.size() == 2);
+	CHECK(image.levels[0].size() == 16 && image.levels[0][0] == 255 && image.levels[0][1] == 0 && image.levels[0][3] == 255);
+	CHECK(image.levels[1].size() == 4 && image.levels[1][0] == 128 && image.levels[1][1] == 128 && image.levels[1][2] == 128 && image.levels[1][3] == 255);
+	CHECK(AssetLoader::decodeImage(fileBytes(std::string{ "P5 3 1 15 " } + '\x0F' + '\x00' + '\x05'), image));
+	CHECK(image.levels.size() == 2 && image.levels[0][0] == 255 && image.levels[0][2] == 255 && image.levels[0][4] == 0 && image.levels[0][8] == 85);
+	CHECK(image.levels[1].size() == 4);
+	CHECK(!AssetLoader::decodeImage(fileBytes(rgb.substr(0, rgb.size() - 1)), image));
+	CHECK(!AssetLoader::decodeImage(fileBytes("P3\n1 1\n255\n0 0 0\n"), image));
+	CHECK(!AssetLoader::decodeImage(fileBytes("P6\n0 1\n255\n"), image));
+	CHECK(!AssetLoader::decodeImage(fileBytes("P6\n1 1\n65535\n\0\0\0\0\0\0"), image));
+	return checkFailures == 0;
+}
+
+// PROFILER
+// --------
+static int countZones(const char* path, const std::string& name)
+{
+	std::ifstream file{ path };
+	std::stringstream text{};
+	text << file.rdbuf();
+	std::string json{ text.str() };
+	std::string pattern{ "{\"name\":\"" + name + "\",\"ph\":\"X\"" };
+	int count{ 0 };
+	for (std::size_t at{ json.find(pattern) }; at != std::string::npos; at = json.find(pattern, at + 1))
+		++count;
+	return count;
+}
+static bool testProfiler()
+{
+	const char* path{ "profiler_test.json" };
+	const int threads{ 4 };
+	const int zones{ 10 };
+	Profiler::setEnabled(true);
+	auto round{ [&]()
+	{
+		std::vector<std::thread> workers{};
+		for (int t{ 0 }; t < threads; ++t)
+		{
+			workers.emplace_back([&]()
+			{
+				for (int i{ 0 }; i < zones; ++i)
+					PROFILE_SCOPE("Test zone");
+			});
+		}
+		for (std::thread& worker : workers)
+			worker.join();
+	} };
+
+	// Threads that exit hand their ring buffers to the next ones, so repeated
+	// thread pools only add the few zones they recorded
+	round();
+	std::size_t firstRound{ Profiler::bufferBytes() };
+	const int rounds{ 20 };
+	for (int r{ 1 }; r < rounds; ++r)
+		round();
+	CHECK(Profiler::bufferBytes() < firstRound + firstRound / 4);
+
+	// Exited threads' zones are still exported, until clear()
+	CHECK(Profiler::writeChromeTrace(path));
+	CHECK(countZones(path, "Test zone") == rounds * threads * zones);
+	Profiler::clear();
+	CHECK(Profiler::bufferBytes() <= firstRound);
+	CHECK(Profiler::writeChromeTrace(path));
+	CHECK(countZones(path, "Test zone") == 0);
+	Profiler::setEnabled(false);
+	std::remove(path);
+	return checkFailures == 0;
+}
+
+// TEST LIST
+// ---------
+static const Test tests[]
+{
+	{ "dispatch", "per-context GL dispatch stubs with missing entries, no table and freed tables", testDispatch },
+	{ "queue", "sort keys, stable radix sorted draw order and which draws merge", testQueue },
+	{ "heap", "best-fit offset allocation, merging of freed ranges", testHeap },
+	{ "mesh", "deduplication, Tipsy and overdraw ordering keep the triangles and improve ACMR", testMesh },
+	{ "vertexformat", "half, snorm16 and octahedral encoding accuracy", testVertexFormat },
+	{ "jobs", "work-stealing deque under contention, parallelFor and nested waits", testJobs },
+	{ "commands", "command arena reuse and command list recording", testCommands },
+	{ "profiler", "zones of exited threads exported and their buffers reused", testProfiler },
+	{ "decoders", "OBJ face forms, negative and out of range indices, PNM headers and mip chains", testDecoders },
+};
+
+// MAIN
+// ----
+int main(int argc, char* argv[])
+{
+	std::vector<const char*> selected{};
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--list") == 0)
+		{
+			for (const Test& test : tests)
+				std::cout << test.name << " - " << test.description << std::endl;
+			return 0;
+		}
+		selected.push_back(argv[i]);
+	}
+
+	int failures{ 0 };
+	for (const Test& test : tests)
+	{
+		bool wanted{ selected.empty() };
+		for (const char* name : selected)
+			wanted = wanted || std::strcmp(name, test.name) == 0;
+		if (!wanted)
+			continue;
+		std::cout << test.name << " (" << test.description << ")" << std::endl;
+		checkFailures = 0;
+		if (!test.run())
+		{
+			std::cout << "  FAILED" << std::endl;
+			++failures;
+		}
+	}
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,276 @@
+#include "VertexFormat.h"
+#include "GLObjects.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+const char* OCTAHEDRAL_DECODE_GLSL{
+	"vec3 octahedralDecode(vec2 e)\n"
+	"{\n"
+	"	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));\n"
+	"	float t = max(-n.z, 0.0);\n"
+	"	n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);\n"
+	"	return normalize(n);\n"
+	"}\n" };
+
+// SCALAR ENCODING
+// ---------------
+std::uint16_t floatToHalf(float value)
+{
+	std::uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	std::uint16_t sign{ (std::uint16_t)((bits >> 16) & 0x8000) };
+	std::uint32_t magnitude{ bits & 0x7FFFFFFF };
+	if (magnitude >= 0x7F800000)
+		return sign | (magnitude > 0x7F800000 ? 0x7E00 : 0x7C00); // NaN stays NaN, infinity stays infinity
+	if (magnitude >= 0x477FF000)
+		return sign | 0x7C00; // 65520 and up round to infinity
+	if (magnitude < 0x38800000)
+	{
+		// Below the smallest normal half: scale so the subnormal's mantissa is the integer part
+		float absolute;
+		std::memcpy(&absolute, &magnitude, sizeof(absolute));
+		return sign | (std::uint16_t)std::lrint(absolute * 16777216.0f);
+	}
+	// Rebias the exponent (127 -> 15) and round the 13 dropped mantissa bits to nearest even
+	std::uint32_t half{ (magnitude - 0x38000000) >> 13 };
+	std::uint32_t dropped{ magnitude & 0x1FFF };
+	if (dropped > 0x1000 || (dropped == 0x1000 && (half & 1)))
+		++half;
+	return sign | (std::uint16_t)half;
+}
+float halfToFloat(std::uint16_t half)
+{
+	std::uint32_t sign{ (std::uint32_t)(half & 0x8000) << 16 };
+	std::uint32_t exponent{ (std::uint32_t)(half >> 10) & 0x1F };
+	std::uint32_t mantissa{ (std::uint32_t)half & 0x3FF };
+	float result;
+	if (exponent == 0)
+		result = std::ldexp((float)mantissa, -24);
+	else if (exponent == 31)
+		result = mantissa == 0 ? INFINITY : NAN;
+	else
+		result = std::ldexp((float)(mantissa | 0x400), (int)exponent - 25);
+	std::uint32_t bits;
+	std::memcpy(&bits, &result, sizeof(bits));
+	bits |= sign;
+	std::memcpy(&result, &bits, sizeof(result));
+	return result;
+}
+std::int16_t floatToSnorm16(float value)
+{
+	value = std::min(std::max(value, -1.0f), 1.0f);
+	return (std::int16_t)std::lrint(value * 32767.0f);
+}
+void octahedralEncode(const float* normal, float* encoded)
+{
+	float sum{ std::fabs(normal[0]) + std::fabs(normal[1]) + std::fabs(normal[2]) };
+	if (sum == 0.0f)
+	{
+		encoded[0] = encoded[1] = 0.0f;
+		return;
+	}
+	float x{ normal[0] / sum };
+	float y{ normal[1] / sum };
+	if (normal[2] < 0.0f)
+	{
+		// Fold the lower half over the diagonals
+		float foldedX{ (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f) };
+		float foldedY{ (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f) };
+		x = foldedX;
+		y = foldedY;
+	}
+	encoded[0] = x;
+	encoded[1] = y;
+}
+void octahedralDecode(const float* encoded, float* normal)
+{
+	float x{ encoded[0] };
+	float y{ encoded[1] };
+	float z{ 1.0f - std::fabs(x) - std::fabs(y) };
+	float t{ std::max(-z, 0.0f) };
+	x += x >= 0.0f ? -t : t;
+	y += y >= 0.0f ? -t : t;
+	float length{ std::sqrt(x * x + y * y + z * z) };
+	normal[0] = x / length;
+	normal[1] = y / length;
+	normal[2] = z / length;
+}
+// FORMAT PROPERTIES
+// -----------------
+struct FormatInfo
+{
+	int components;
+	GLenum type;
+	bool normalized;
+	unsigned int size;
+};
+static FormatInfo formatInfo(VertexFormat format)
+{
+	switch (format)
+	{
+	case VertexFormat::Float2: return FormatInfo{ 2, GL_FLOAT, false, 8 };
+	case VertexFormat::Float3: return FormatInfo{ 3, GL_FLOAT, false, 12 };
+	case VertexFormat::Float4: return FormatInfo{ 4, GL_FLOAT, false, 16 };
+	case VertexFormat::Half2: return FormatInfo{ 2, GL_HALF_FLOAT, false, 4 };
+	case VertexFormat::Half4: return FormatInfo{ 4, GL_HALF_FLOAT, false, 8 };
+	case VertexFormat::Snorm16x4: return FormatInfo{ 4, GL_SHORT, true, 8 };
+	case VertexFormat::Octahedral16: return FormatInfo{ 2, GL_SHORT, true, 4 };
+	case VertexFormat::OctahedralTangent16: return FormatInfo{ 4, GL_SHORT, true, 8 };
+	case VertexFormat::Unorm8x4: return FormatInfo{ 4, GL_UNSIGNED_BYTE, true, 4 };
+	}
+	return FormatInfo{ 0, GL_FLOAT, false, 0 };
+}
+static int semanticComponents(VertexSemantic semantic)
+{
+	switch (semantic)
+	{
+	case VertexSemantic::Position: return 3;
+	case VertexSemantic::Normal: return 3;
+	case VertexSemantic::Tangent: return 4;
+	case VertexSemantic::TexCoord: return 2;
+	case VertexSemantic::Color: return 4;
+	}
+	return 0;
+}
+static const float* semanticSource(const VertexSource& source, VertexSemantic semantic)
+{
+	switch (semantic)
+	{
+	case VertexSemantic::Position: return source.positions;
+	case VertexSemantic::Normal: return source.normals;
+	case VertexSemantic::Tangent: return source.tangents;
+	case VertexSemantic::TexCoord: return source.texCoords;
+	case VertexSemantic::Color: return source.colors;
+	}
+	return nullptr;
+}
+// VERTEX LAYOUT
+// -------------
+VertexLayout& VertexLayout::add(VertexSemantic semantic, unsigned int location, VertexFormat format)
+{
+	m_elements.push_back(Element{ semantic, location, format, (unsigned int)m_stride });
+	m_stride += formatInfo(format).size;
+	return *this;
+}
+VertexLayout VertexLayout::full()
+{
+	VertexLayout layout{};
+	layout.add(VertexSemantic::Position, 0, VertexFormat::Float3)
+		.add(VertexSemantic::Normal, 1, VertexFormat::Float3)
+		.add(VertexSemantic::TexCoord, 2, VertexFormat::Float2);
+	return layout;
+}
+VertexLayout VertexLayout::compressed()
+{
+	VertexLayout layout{};
+	layout.add(VertexSemantic::Position, 0, VertexFormat::Snorm16x4)
+		.add(VertexSemantic::Normal, 1, VertexFormat::Octahedral16)
+		.add(VertexSemantic::TexCoord, 2, VertexFormat::Half2);
+	return layout;
+}
+void VertexLayout::apply(VertexArray& vertexArray, unsigned int binding, const Buffer& buffer, GLintptr offset) const
+{
+	vertexArray.setVertexBuffer(binding, buffer, offset, m_stride);
+	for (const Element& element : m_elements)
+	{
+		FormatInfo info{ formatInfo(element.format) };
+		vertexArray.setAttribute(element.location, binding, info.components, info.type, info.normalized, element.offset);
+	}
+}
+PackedVertices VertexLayout::pack(const VertexSource& source) const
+{
+	PackedVertices packed{};
+	packed.data.assign((std::size_t)source.count * m_stride, 0);
+
+	// Quantized positions are stored relative to the bounding box
+	if (source.positions != nullptr && source.count > 0)
+	{
+		float minimum[3]{ INFINITY, INFINITY, INFINITY };
+		float maximum[3]{ -INFINITY, -INFINITY, -INFINITY };
+		for (std::uint32_t v{ 0 }; v < source.count; ++v)
+		{
+			const float* position{ source.positions + (std::size_t)v * source.floatStride };
+			for (int axis{ 0 }; axis < 3; ++axis)
+			{
+				minimum[axis] = std::min(minimum[axis], position[axis]);
+				maximum[axis] = std::max(maximum[axis], position[axis]);
+			}
+		}
+		for (int axis{ 0 }; axis < 3; ++axis)
+		{
+			float extent{ (maximum[axis] - minimum[axis]) * 0.5f };
+			packed.positionScale[axis] = extent > 0.0f ? extent : 1.0f;
+			packed.positionOffset[axis] = (maximum[axis] + minimum[axis]) * 0.5f;
+		}
+	}
+	bool quantizedPositions{ false };
+	for (const Element& element : m_elements)
+		quantizedPositions = quantizedPositions || (element.semantic == VertexSemantic::Position && element.format == VertexFormat::Snorm16x4);
+	if (!quantizedPositions)
+	{
+		for (int axis{ 0 }; axis < 3; ++axis)
+		{
+			packed.positionScale[axis] = 1.0f;
+			packed.positionOffset[axis] = 0.0f;
+		}
+	}
+
+	for (const Element& element : m_elements)
+	{
+		const float* input{ semanticSource(source, element.semantic) };
+		int inputComponents{ semanticComponents(element.semantic) };
+		for (std::uint32_t v{ 0 }; v < source.count; ++v)
+		{
+			// Missing inputs read as zero, missing color alpha as opaque
+			float value[4]{ 0.0f, 0.0f, 0.0f, element.semantic == VertexSemantic::Color ? 1.0f : 0.0f };
+			if (input != nullptr)
+				std::copy(input + (std::size_t)v * source.floatStride, input + (std::size_t)v * source.floatStride + inputComponents, value);
+			unsigned char* output{ &packed.data[(std::size_t)v * m_stride + element.offset] };
+			switch (element.format)
+			{
+			case VertexFormat::Float2:
+			case VertexFormat::Float3:
+			case VertexFormat::Float4:
+				std::memcpy(output, value, formatInfo(element.format).size);
+				break;
+			case VertexFormat::Half2:
+			case VertexFormat::Half4:
+			{
+				std::uint16_t halves[4];
+				for (int c{ 0 }; c < 4; ++c)
+					halves[c] = floatToHalf(value[c]);
+				std::memcpy(output, halves, formatInfo(element.format).size);
+				break;
+			}
+			case VertexFormat::Snorm16x4:
+			{
+				std::int16_t snorms[4];
+				for (int c{ 0 }; c < 4; ++c)
+				{
+					float component{ value[c] };
+					if (element.semantic == VertexSemantic::Position && c < 3)
+						component = (component - packed.positionOffset[c]) / packed.positionScale[c];
+					snorms[c] = floatToSnorm16(component);
+				}
+				std::memcpy(output, snorms, sizeof(snorms));
+				break;
+			}
+			case VertexFormat::Octahedral16:
+			case VertexFormat::OctahedralTangent16:
+			{
+				float encoded[2];
+				octahedralEncode(value, encoded);
+				std::int16_t snorms[4]{ floatToSnorm16(encoded[0]), floatToSnorm16(encoded[1]), floatToSnorm16(value[3] < 0.0f ? -1.0f : 1.0f), 0 };
+				std::memcpy(output, snorms, formatInfo(element.format).size);
+				break;
+			}
+			case VertexFormat::Unorm8x4:
+				for (int c{ 0 }; c < 4; ++c)
+					output[c] = (unsigned char)std::lrint(std::min(std::max(value[c], 0.0f), 1.0f) * 255.0f);
+				break;
+			}
+		}
+	}
+	return packed;
+}
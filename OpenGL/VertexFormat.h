@@ -0,0 +1,105 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+#include <vector>
+
+class Buffer;
+class VertexArray;
+
+// VERTEX FORMATS
+// --------------
+// Storage formats an attribute can be packed to, with their size per vertex:
+//   Float2/3/4           8/12/16 bytes, unchanged
+//   Half2/Half4          4/8 bytes, IEEE half floats (positions, UVs)
+//   Snorm16x4            8 bytes, position quantized to the mesh bounds, the
+//                        shader rebuilds it with the packed positionScale/Offset
+//   Octahedral16         4 bytes, unit vector mapped onto an octahedron (normals)
+//   OctahedralTangent16  8 bytes, octahedral xy plus the bitangent sign in z
+//   Unorm8x4             4 bytes, colors
+enum class VertexFormat
+{
+	Float2,
+	Float3,
+	Float4,
+	Half2,
+	Half4,
+	Snorm16x4,
+	Octahedral16,
+	OctahedralTangent16,
+	Unorm8x4
+};
+
+enum class VertexSemantic
+{
+	Position, // 3 floats
+	Normal,   // 3 floats
+	Tangent,  // 4 floats, w is the bitangent sign
+	TexCoord, // 2 floats
+	Color     // 4 floats
+};
+
+// Unpacked input: pointers to each semantic's first vertex, all advancing by
+// floatStride floats per vertex (so interleaved and separate arrays both work)
+struct VertexSource
+{
+	const float* positions{ nullptr };
+	const float* normals{ nullptr };
+	const float* tangents{ nullptr };
+	const float* texCoords{ nullptr };
+	const float* colors{ nullptr };
+	int floatStride{ 3 };
+	std::uint32_t count{ 0 };
+};
+
+struct PackedVertices
+{
+	std::vector<unsigned char> data{};
+	// position = attribute.xyz * positionScale + positionOffset (identity unless Snorm16x4)
+	float positionScale[3]{ 1.0f, 1.0f, 1.0f };
+	float positionOffset[3]{ 0.0f, 0.0f, 0.0f };
+};
+
+// GLSL for the vertex shader side: vec3 octahedralDecode(vec2) for Octahedral16
+// attributes (the xy of OctahedralTangent16 ones)
+extern const char* OCTAHEDRAL_DECODE_GLSL;
+
+// VERTEX LAYOUT
+// -------------
+// Describes which semantic goes to which attribute location in which format.
+// pack() converts float data into the layout's interleaved vertices and
+// apply() sets up the matching attribute formats on a VertexArray, so the two
+// can never disagree.
+class VertexLayout
+{
+public:
+	VertexLayout& add(VertexSemantic semantic, unsigned int location, VertexFormat format);
+
+	PackedVertices pack(const VertexSource& source) const;
+	void apply(VertexArray& vertexArray, unsigned int binding, const Buffer& buffer, GLintptr offset = 0) const;
+
+	GLsizei stride() const { return m_stride; }
+
+	// position/normal/UV at locations 0/1/2: 32 bytes as floats, 16 compressed
+	static VertexLayout full();
+	static VertexLayout compressed();
+
+private:
+	struct Element
+	{
+		VertexSemantic semantic;
+		unsigned int location;
+		VertexFormat format;
+		unsigned int offset;
+	};
+
+	std::vector<Element> m_elements{};
+	GLsizei m_stride{ 0 };
+};
+
+// SCALAR ENCODING
+// ---------------
+std::uint16_t floatToHalf(float value);
+float halfToFloat(std::uint16_t half);
+std::int16_t floatToSnorm16(float value);
+void octahedralEncode(const float* normal, float* encoded);
+void octahedralDecode(const float* encoded, float* normal);
@@ -165,96 +165,143 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
+/* Extension set: all extension names of the current context copied into a
+ * single allocation together with an open addressing hash table over them,
+ * so gladHasExtension() is one hash and usually one string compare. The
+ * block is laid out as [slot hashes][slot names][name characters]. The
+ * gladExtensionSet type lives in glad.h so GladGLContext can embed one. */
+static gladExtensionSet glad_extensions = { NULL, NULL, NULL, 0, 0 };
 
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
-        }
-
-        if (exts_i == NULL) {
-            return 0;
-        }
-
-        for(index = 0; index < num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
-
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
-        }
+static unsigned int hash_ext(const char *name, size_t length) {
+    /* FNV-1a, 0 is reserved for empty slots */
+    unsigned int hash = 2166136261u;
+    size_t index;
+    for(index = 0; index < length; index++) {
+        hash ^= (unsigned char)name[index];
+        hash *= 16777619u;
     }
-#endif
-    return 1;
+    return hash != 0 ? hash : 1;
 }
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
+static void free_exts(gladExtensionSet *set) {
+    free(set->block);
+    set->block = NULL;
+    set->hashes = NULL;
+    set->names = NULL;
+    set->mask = 0;
+    set->count = 0;
+}
+
+static void insert_ext(gladExtensionSet *set, char **characters, const char *name, size_t length) {
+    unsigned int hash = hash_ext(name, length);
+    unsigned int slot = hash & set->mask;
+    while(set->hashes[slot] != 0) {
+        if(set->hashes[slot] == hash && strncmp(set->names[slot], name, length) == 0
+            && set->names[slot][length] == '\0') {
+            return;
         }
-        free((void *)exts_i);
-        exts_i = NULL;
+        slot = (slot + 1) & set->mask;
     }
+    memcpy(*characters, name, length);
+    (*characters)[length] = '\0';
+    set->hashes[slot] = hash;
+    set->names[slot] = *characters;
+    *characters += length + 1;
+    set->count++;
 }
 
-static int has_ext(const char *ext) {
+static int get_exts(gladExtensionSet *set, int major, PFNGLGETSTRINGPROC getString,
+    PFNGLGETINTEGERVPROC getIntegerv, PFNGLGETSTRINGIPROC getStringi) {
+    const char *exts = NULL;
+    int num_exts_i = 0;
+    int index;
+    size_t total = 0;
+    unsigned int slots = 1;
+    char *characters;
+
+    free_exts(set);
 #ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
+    if(major < 3) {
 #endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
+        exts = (const char *)getString(GL_EXTENSIONS);
+        if(exts == NULL) {
             return 0;
         }
+        total = strlen(exts) + 1;
+        for(index = 0; exts[index] != '\0'; index++) {
+            num_exts_i += exts[index] == ' ';
+        }
+        num_exts_i++;
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    } else {
+        getIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
+        for(index = 0; index < num_exts_i; index++) {
+            const char *gl_str_tmp = (const char*)getStringi(GL_EXTENSIONS, index);
+            total += gl_str_tmp != NULL ? strlen(gl_str_tmp) + 1 : 0;
+        }
+    }
+#endif
 
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
+    /* Keep the table at most half full so probe sequences stay short */
+    while(slots < 2 * (unsigned int)(num_exts_i > 0 ? num_exts_i : 1)) {
+        slots <<= 1;
+    }
+    set->block = calloc(1, slots * (sizeof *set->hashes + sizeof *set->names) + total);
+    if(set->block == NULL) {
+        return 0;
+    }
+    set->hashes = (unsigned int *)set->block;
+    set->names = (const char **)(set->hashes + slots);
+    set->mask = slots - 1;
+    characters = (char *)(set->names + slots);
 
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
+    if(exts != NULL) {
+        const char *begin = exts;
+        while(*begin != '\0') {
+            const char *end = strchr(begin, ' ');
+            size_t length = end != NULL ? (size_t)(end - begin) : strlen(begin);
+            if(length > 0) {
+                insert_ext(set, &characters, begin, length);
             }
-            extensions = terminator;
+            if(end == NULL) break;
+            begin = end + 1;
         }
-#ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
-        int index;
-        if(exts_i == NULL) return 0;
         for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
-
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
+            const char *gl_str_tmp = (const char*)getStringi(GL_EXTENSIONS, index);
+            if(gl_str_tmp != NULL) {
+                insert_ext(set, &characters, gl_str_tmp, strlen(gl_str_tmp));
             }
         }
     }
-#endif
+    return 1;
+}
 
+static int has_ext(const gladExtensionSet *set, const char *ext) {
+    size_t length;
+    unsigned int hash;
+    unsigned int slot;
+    if(set->block == NULL || ext == NULL) {
+        return 0;
+    }
+
+    length = strlen(ext);
+    hash = hash_ext(ext, length);
+    slot = hash & set->mask;
+    while(set->hashes[slot] != 0) {
+        if(set->hashes[slot] == hash && strcmp(set->names[slot], ext) == 0) {
+            return 1;
+        }
+        slot = (slot + 1) & set->mask;
+    }
     return 0;
 }
+
+int gladHasExtension(const char *ext) {
+    const GladGLContext *context = gladGetCurrentContext();
+    return has_ext(context != NULL ? &context->extensions : &glad_extensions, ext);
+}
+
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
 int GLAD_GL_VERSION_1_2 = 0;
@@ -1734,21 +1781,18 @@ static void load_GL_VERSION_4_6(GLADloadproc load) {
 	glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)load("glPolygonOffsetClamp");
 }
 static int find_extensionsGL(void) {
-	if (!get_exts()) return 0;
-	(void)&has_ext;
-	free_exts();
+	if (!get_exts(&glad_extensions, max_loaded_major, glad_glGetString, glad_glGetIntegerv, glad_glGetStringi)) return 0;
 	return 1;
 }
 
-static void find_coreGL(void) {
+static int parse_version(const char *version, int *major, int *minor) {
 
     /* Thank you @elmindreda
      * https://github.com/elmindreda/greg/blob/master/templates/greg.c.in#L176
      * https://github.com/glfw/glfw/blob/master/src/context.c#L36
      */
-    int i, major, minor;
+    int i;
 
-    const char* version;
     const char* prefixes[] = {
         "OpenGL ES-CM ",
         "OpenGL ES-CL ",
@@ -1756,8 +1800,7 @@ static void find_coreGL(void) {
         NULL
     };
 
-    version = (const char*) glGetString(GL_VERSION);
-    if (!version) return;
+    if (!version) return 0;
 
     for (i = 0;  prefixes[i];  i++) {
         const size_t length = strlen(prefixes[i]);
@@ -1769,11 +1812,13 @@ static void find_coreGL(void) {
 
 /* PR #18 */
 #ifdef _MSC_VER
-    sscanf_s(version, "%d.%d", &major, &minor);
+    return sscanf_s(version, "%d.%d", major, minor) == 2;
 #else
-    sscanf(version, "%d.%d", &major, &minor);
+    return sscanf(version, "%d.%d", major, minor) == 2;
 #endif
+}
 
+static void set_coreGL(int major, int minor) {
     GLVersion.major = major; GLVersion.minor = minor;
     max_loaded_major = major; max_loaded_minor = minor;
 	GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
@@ -1801,6 +1846,12 @@ static void find_coreGL(void) {
 	}
 }
 
+static void find_coreGL(void) {
+    int major, minor;
+    if (!parse_version((const char*) glGetString(GL_VERSION), &major, &minor)) return;
+    set_coreGL(major, minor);
+}
+
 int gladLoadGLLoader(GLADloadproc load) {
 	GLVersion.major = 0; GLVersion.minor = 0;
 	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
@@ -1831,3 +1882,260 @@ int gladLoadGLLoader(GLADloadproc load) {
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+/* LAZY BINDING */
+
+static GLADloadproc glad_lazy_load = NULL;
+
+static void* glad_lazy_resolve(const char *name) {
+    void* proc = glad_lazy_load != NULL ? glad_lazy_load(name) : NULL;
+    if(proc == NULL) {
+        fprintf(stderr, "glad: %s is not available in this context\n", name);
+        abort();
+    }
+    return proc;
+}
+
+/* One trampoline per entry point: resolve, patch the pointer, forward the call.
+ * Racing threads resolve to the same address, so the pointer store is benign. */
+#define GLAD_PROC(version, type, ret, name, params, args) \
+    static ret APIENTRY glad_lazy_gl##name params { \
+        glad_gl##name = (type)glad_lazy_resolve("gl" #name); \
+        return glad_gl##name args; \
+    }
+#define GLAD_PROC_VOID(version, type, name, params, args) \
+    static void APIENTRY glad_lazy_gl##name params { \
+        glad_gl##name = (type)glad_lazy_resolve("gl" #name); \
+        glad_gl##name args; \
+    }
+#include <glad/glad_procs.h>
+
+/* Functions outside the context version stay NULL, same as the eager loader. */
+static void load_GL_lazy(void) {
+#define GLAD_PROC(version, type, ret, name, params, args) \
+    glad_gl##name = GLAD_GL_##version ? glad_lazy_gl##name : NULL;
+#include <glad/glad_procs.h>
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glad_lazy_load = load;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	load_GL_lazy();
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+
+	if (!find_extensionsGL()) return 0;
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
+/* PER-CONTEXT DISPATCH */
+
+#if defined(_MSC_VER)
+#define GLAD_THREAD_LOCAL __declspec(thread)
+#else
+#define GLAD_THREAD_LOCAL __thread
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define GLAD_ATOMIC_EXCHANGE(target, value) _InterlockedExchange((target), (value))
+#define GLAD_ATOMIC_LOAD(source) _InterlockedCompareExchange((source), 0, 0)
+#define GLAD_ATOMIC_STORE(target, value) (void)_InterlockedExchange((target), (value))
+#else
+#define GLAD_ATOMIC_EXCHANGE(target, value) __atomic_exchange_n((target), (value), __ATOMIC_ACQ_REL)
+#define GLAD_ATOMIC_LOAD(source) __atomic_load_n((source), __ATOMIC_ACQUIRE)
+#define GLAD_ATOMIC_STORE(target, value) __atomic_store_n((target), (value), __ATOMIC_RELEASE)
+#endif
+
+static GLAD_THREAD_LOCAL GladGLContext *glad_current_context = NULL;
+
+/* Tables that are loaded and not freed yet. gladFreeGLContext() can't reach
+ * the other threads' current pointers, so it bumps glad_free_epoch instead;
+ * a thread that sees a new epoch checks its table against this list before
+ * calling through it again. */
+static GladGLContext **glad_live_contexts = NULL;
+static int glad_live_count = 0;
+static int glad_live_capacity = 0;
+static volatile long glad_live_lock = 0;
+static volatile long glad_free_epoch = 0;
+static GLAD_THREAD_LOCAL long glad_current_epoch = 0;
+
+static void lock_live(void) {
+    while(GLAD_ATOMIC_EXCHANGE(&glad_live_lock, 1) != 0) {
+    }
+}
+
+static void unlock_live(void) {
+    GLAD_ATOMIC_STORE(&glad_live_lock, 0);
+}
+
+static int find_live(const GladGLContext *context) {
+    int index;
+    for(index = 0; index < glad_live_count; index++) {
+        if(glad_live_contexts[index] == context) {
+            return index;
+        }
+    }
+    return -1;
+}
+
+static int add_live(GladGLContext *context) {
+    int added = 1;
+    lock_live();
+    if(find_live(context) < 0) {
+        if(glad_live_count == glad_live_capacity) {
+            int capacity = glad_live_capacity > 0 ? glad_live_capacity * 2 : 8;
+            GladGLContext **contexts = (GladGLContext **)realloc(glad_live_contexts, capacity * sizeof *contexts);
+            if(contexts != NULL) {
+                glad_live_contexts = contexts;
+                glad_live_capacity = capacity;
+            }
+        }
+        if(glad_live_count < glad_live_capacity) {
+            glad_live_contexts[glad_live_count++] = context;
+        } else {
+            added = 0;
+        }
+    }
+    unlock_live();
+    return added;
+}
+
+static void remove_live(const GladGLContext *context) {
+    int index;
+    lock_live();
+    index = find_live(context);
+    if(index >= 0) {
+        glad_live_contexts[index] = glad_live_contexts[--glad_live_count];
+        GLAD_ATOMIC_STORE(&glad_free_epoch, glad_free_epoch + 1);
+    }
+    unlock_live();
+}
+
+/* The calling thread's table, NULL when it has none or it was freed since */
+static GladGLContext* checked_current_context(void) {
+    long epoch = GLAD_ATOMIC_LOAD(&glad_free_epoch);
+    if(glad_current_epoch != epoch) {
+        if(glad_current_context != NULL) {
+            lock_live();
+            if(find_live(glad_current_context) < 0) {
+                glad_current_context = NULL;
+            }
+            unlock_live();
+        }
+        glad_current_epoch = epoch;
+    }
+    return glad_current_context;
+}
+
+/* Minimum version encoded as major * 10 + minor for every VERSION_X_Y section */
+#define GLAD_VERSION_VERSION_1_0 10
+#define GLAD_VERSION_VERSION_1_1 11
+#define GLAD_VERSION_VERSION_1_2 12
+#define GLAD_VERSION_VERSION_1_3 13
+#define GLAD_VERSION_VERSION_1_4 14
+#define GLAD_VERSION_VERSION_1_5 15
+#define GLAD_VERSION_VERSION_2_0 20
+#define GLAD_VERSION_VERSION_2_1 21
+#define GLAD_VERSION_VERSION_3_0 30
+#define GLAD_VERSION_VERSION_3_1 31
+#define GLAD_VERSION_VERSION_3_2 32
+#define GLAD_VERSION_VERSION_3_3 33
+#define GLAD_VERSION_VERSION_4_0 40
+#define GLAD_VERSION_VERSION_4_1 41
+#define GLAD_VERSION_VERSION_4_2 42
+#define GLAD_VERSION_VERSION_4_3 43
+#define GLAD_VERSION_VERSION_4_4 44
+#define GLAD_VERSION_VERSION_4_5 45
+#define GLAD_VERSION_VERSION_4_6 46
+#define GLAD_CONTEXT_HAS_VERSION(context, version) \
+    ((context)->major * 10 + (context)->minor >= GLAD_VERSION_##version)
+
+int gladLoadGLContext(GladGLContext *context, GLADloadproc load) {
+    memset(context, 0, sizeof *context);
+    context->glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+    if(context->glGetString == NULL) return 0;
+    if(!parse_version((const char*)context->glGetString(GL_VERSION), &context->major, &context->minor)) return 0;
+    if(context->major > 4 || (context->major == 4 && context->minor > 6)) {
+        context->major = 4;
+        context->minor = 6;
+    }
+
+#define GLAD_PROC(version, type, ret, name, params, args) \
+    context->gl##name = GLAD_CONTEXT_HAS_VERSION(context, version) ? (type)load("gl" #name) : NULL;
+#include <glad/glad_procs.h>
+
+    if(!get_exts(&context->extensions, context->major, context->glGetString,
+        context->glGetIntegerv, context->glGetStringi)) return 0;
+    return add_live(context);
+}
+
+void gladFreeGLContext(GladGLContext *context) {
+    remove_live(context);
+    if(glad_current_context == context) {
+        glad_current_context = NULL;
+    }
+    free_exts(&context->extensions);
+}
+
+int gladContextHasExtension(const GladGLContext *context, const char *ext) {
+    return has_ext(&context->extensions, ext);
+}
+
+void gladMakeContextCurrent(GladGLContext *context) {
+    glad_current_context = context;
+    glad_current_epoch = GLAD_ATOMIC_LOAD(&glad_free_epoch);
+}
+
+GladGLContext* gladGetCurrentContext(void) {
+    return checked_current_context();
+}
+
+/* Dispatch stubs: forward every call through the calling thread's table.
+ * Without a table, or for an entry the table doesn't have, the call does
+ * nothing and returns 0 instead of jumping through NULL. */
+#define GLAD_PROC(version, type, ret, name, params, args) \
+    static ret APIENTRY glad_dispatch_gl##name params { \
+        GladGLContext *context = checked_current_context(); \
+        if(context == NULL || context->gl##name == NULL) return (ret)0; \
+        return context->gl##name args; \
+    }
+#define GLAD_PROC_VOID(version, type, name, params, args) \
+    static void APIENTRY glad_dispatch_gl##name params { \
+        GladGLContext *context = checked_current_context(); \
+        if(context == NULL || context->gl##name == NULL) return; \
+        context->gl##name args; \
+    }
+#include <glad/glad_procs.h>
+
+/* Lowest version of the tables that enabled dispatch, 0 before the first */
+static int glad_dispatch_version = 0;
+
+/* Entries stay NULL unless a table made current here (now or in an earlier
+ * call) has them, so "glFoo != NULL" keeps working as a capability check.
+ * The globals are process wide while tables are per thread: rewrites are
+ * serialised by the live lock and a global is only stored when its value
+ * changes, and GLVersion only ever drops to a lower table's version. With
+ * every context at the same version, as required, nothing another thread
+ * reads is written after the first table. */
+void gladUseContextDispatch(void) {
+    GladGLContext *context = checked_current_context();
+    lock_live();
+    if(context != NULL) {
+        int version = context->major * 10 + context->minor;
+        if(glad_dispatch_version == 0 || version < glad_dispatch_version) {
+            glad_dispatch_version = version;
+            set_coreGL(context->major, context->minor);
+        }
+    }
+#define GLAD_PROC(version, type, ret, name, params, args) \
+    { \
+        type entry = (context != NULL && context->gl##name != NULL) || glad_gl##name == glad_dispatch_gl##name \
+            ? glad_dispatch_gl##name : NULL; \
+        if(glad_gl##name != entry) glad_gl##name = entry; \
+    }
+#include <glad/glad_procs.h>
+    unlock_live();
+}